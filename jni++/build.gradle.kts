@@ -21,6 +21,14 @@ tasks.jar {
 group = "dev.tmich"
 version = "1.0"
 
+// Java side of the native jni++_bench benchmarks (src/bench/cpp)
+sourceSets {
+    create("bench") {
+        compileClasspath += sourceSets.main.get().output
+        runtimeClasspath += sourceSets.main.get().output
+    }
+}
+
 dependencies {
     testImplementation("org.junit.jupiter:junit-jupiter-api:5.8.2")
     testRuntimeOnly("org.junit.jupiter:junit-jupiter-engine:5.8.2")
@@ -37,6 +45,7 @@ tasks.register<Copy>("copyJar") {
 
 tasks.build {
   dependsOn("copyJar")
+  dependsOn("benchClasses")
 }
 java {
     sourceCompatibility = JavaVersion.VERSION_1_8
@@ -0,0 +1,136 @@
+//
+// BenchHarness.hpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "JniPlusPlus.hpp"
+
+namespace jni_pp::bench {
+
+struct BenchResult {
+    std::string name;
+    int threads;
+    uint64_t operations;
+    double seconds;
+
+    double nsPerOp() const { return operations ? (seconds * 1e9) / double(operations) : 0.0; }
+    double opsPerSecond() const { return seconds > 0 ? double(operations) / seconds : 0.0; }
+    double opsPerSecondPerThread() const { return threads ? opsPerSecond() / threads : 0.0; }
+};
+
+typedef std::function<void()> BenchFunction;
+
+//
+// Benchmarks register themselves at static init time (see JNIPP_BENCH) and are run, in registration order, by
+// BenchMain once the VM is up.
+//
+std::vector<std::pair<std::string, BenchFunction>>& registeredBenchmarks();
+
+struct BenchRegistrar {
+    BenchRegistrar(const std::string& name, BenchFunction fn) {
+        registeredBenchmarks().emplace_back(name, std::move(fn));
+    }
+};
+
+#define JNIPP_BENCH(benchName) \
+    static void benchName(); \
+    static ::jni_pp::bench::BenchRegistrar benchName##_registrar(#benchName, benchName); \
+    static void benchName()
+
+// Number of iterations each measured loop runs.  Can be overridden on the command line.
+uint64_t iterations();
+void setIterations(uint64_t count);
+
+typedef enum OutputFormat {
+    FORMAT_TEXT,    // Human readable, one line per result as it is reported
+    FORMAT_CSV,     // Header line then one line per result as it is reported
+    FORMAT_JSON     // One array of result objects, written once all benchmarks have run
+} OutputFormat;
+
+void setOutputFormat(OutputFormat format);
+
+// Name of the JNIPP_BENCH the results being reported belong to.  Set by BenchMain.
+void setCurrentSuite(const std::string& suite);
+
+void report(const BenchResult& result);
+
+// Write anything report() held back (JSON).  Called by BenchMain after all benchmarks have run.
+void finishReport();
+
+// Keep the optimizer from discarding a computed value.
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+//
+// Time iterations calls to fn on the calling thread.
+//
+template <typename Fn>
+BenchResult runOnCurrentThread(const std::string& name, uint64_t count, Fn&& fn) {
+    // One untimed pass so lazy method lookup isn't part of the measurement.
+    fn();
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < count; ++i) {
+        fn();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return BenchResult{name, 1, count, elapsed.count()};
+}
+
+//
+// Attach numThreads threads to the VM and have each of them call fn count times.  All threads are released at the
+// same moment and the wall clock time until the last one finishes is reported, so opsPerSecondPerThread() stays flat
+// as long as the calls don't contend with each other.
+//
+template <typename Fn>
+BenchResult runOnThreads(const std::string& name, int numThreads, uint64_t count, Fn&& fn) {
+    std::latch ready(numThreads + 1);
+    std::latch go(1);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&] {
+            bool attached = attachCurrentThread();
+            fn();  // Warm up this thread's env and the method lookup
+            ready.count_down();
+            go.wait();
+            for (uint64_t i = 0; i < count; ++i) {
+                fn();
+            }
+            if (attached) {
+                detachCurrentThread();
+            }
+        });
+    }
+
+    ready.arrive_and_wait();
+    auto start = std::chrono::steady_clock::now();
+    go.count_down();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return BenchResult{name, numThreads, count * numThreads, elapsed.count()};
+}
+
+} // namespace jni_pp::bench
@@ -0,0 +1,168 @@
+//
+// BenchMain.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "BenchHarness.hpp"
+
+using namespace jni_pp;
+
+// Same layout as the tests: current directory is native_project/<build dir>/jni++_bench
+static constexpr const auto kClasspath = "../../../jni++/build/classes/java/main:../../../jni++/build/classes/java/test:../../../jni++/build/classes/java/bench";
+
+namespace jni_pp::bench {
+
+static uint64_t gIterations = 1'000'000;
+static OutputFormat gFormat = FORMAT_TEXT;
+static std::string gCurrentSuite;
+static std::vector<std::pair<std::string, BenchResult>> gResults;
+
+std::vector<std::pair<std::string, BenchFunction>>& registeredBenchmarks() {
+    static std::vector<std::pair<std::string, BenchFunction>> benchmarks;
+    return benchmarks;
+}
+
+uint64_t iterations() {
+    return gIterations;
+}
+
+void setIterations(uint64_t count) {
+    gIterations = count;
+}
+
+void setOutputFormat(OutputFormat format) {
+    gFormat = format;
+    if (format == FORMAT_CSV) {
+        printf("suite,name,threads,operations,seconds,ns_per_op,ops_per_second\n");
+    }
+}
+
+void setCurrentSuite(const std::string& suite) {
+    gCurrentSuite = suite;
+}
+
+// Quote a CSV field if needed.  Result names often contain commas (template argument lists).
+static std::string csvField(const std::string& value) {
+    if (value.find_first_of(",\"\n") == std::string::npos) {
+        return value;
+    }
+    std::string quoted("\"");
+    for (char c : value) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+static std::string jsonString(const std::string& value) {
+    std::string escaped("\"");
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+void report(const BenchResult& result) {
+    switch (gFormat) {
+        case FORMAT_TEXT:
+            printf("%-48s threads=%-3d ops=%-11llu %10.1f ns/op %14.0f ops/s %14.0f ops/s/thread\n",
+                   result.name.c_str(), result.threads, (unsigned long long) result.operations,
+                   result.nsPerOp(), result.opsPerSecond(), result.opsPerSecondPerThread());
+            break;
+        case FORMAT_CSV:
+            printf("%s,%s,%d,%llu,%.9f,%.3f,%.1f\n", csvField(gCurrentSuite).c_str(), csvField(result.name).c_str(),
+                   result.threads, (unsigned long long) result.operations, result.seconds, result.nsPerOp(),
+                   result.opsPerSecond());
+            break;
+        case FORMAT_JSON:
+            gResults.emplace_back(gCurrentSuite, result);
+            break;
+    }
+    fflush(stdout);
+}
+
+void finishReport() {
+    if (gFormat != FORMAT_JSON) {
+        return;
+    }
+    printf("[\n");
+    for (size_t i = 0; i < gResults.size(); ++i) {
+        auto& [suite, result] = gResults[i];
+        printf("  {\"suite\": %s, \"name\": %s, \"threads\": %d, \"operations\": %llu, \"seconds\": %.9f, "
+               "\"ns_per_op\": %.3f, \"ops_per_second\": %.1f}%s\n",
+               jsonString(suite).c_str(), jsonString(result.name).c_str(), result.threads,
+               (unsigned long long) result.operations, result.seconds, result.nsPerOp(), result.opsPerSecond(),
+               i + 1 < gResults.size() ? "," : "");
+    }
+    printf("]\n");
+    fflush(stdout);
+}
+
+} // namespace jni_pp::bench
+
+//
+// Usage: jni++_bench [--iterations N] [--filter substring] [--format text|csv|json] [classpath]
+//
+// Log output goes to stderr so csv and json output on stdout can be redirected straight to a file.
+//
+int main(int argc, const char **argv) {
+    setLogger(std::make_shared<JniStreamLogger>(std::cerr));
+    setMinimumLogLevel(LOG_WARN);
+
+    std::string classPath(kClasspath);
+    std::string filter;
+    std::string format("text");
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            bench::setIterations(strtoull(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            format = argv[++i];
+        } else {
+            classPath = argv[i];
+        }
+    }
+
+    if (format == "csv") {
+        bench::setOutputFormat(bench::FORMAT_CSV);
+    } else if (format == "json") {
+        bench::setOutputFormat(bench::FORMAT_JSON);
+    } else if (format != "text") {
+        std::cerr << "Error: Unknown format '" << format << "', expected text, csv or json" << std::endl;
+        return -1;
+    }
+
+    if (!createVM(JNI_VERSION_10, classPath)) {
+        std::cerr << "Error: Failed to create Java VM!" << std::endl;
+        return -1;
+    }
+
+    for (auto& [name, fn] : bench::registeredBenchmarks()) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            continue;
+        }
+        bench::setCurrentSuite(name);
+        fn();
+    }
+    bench::finishReport();
+
+    destroyVM();
+    return 0;
+}
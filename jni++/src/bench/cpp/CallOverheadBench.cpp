@@ -0,0 +1,316 @@
+//
+// CallOverheadBench.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <string>
+
+#include "BenchHarness.hpp"
+#include "jnipp/BoxedPrimatives.hpp"
+
+using namespace jni_pp;
+using namespace jni_pp::bench;
+
+//
+// Per-call overhead of each jni++ abstraction against the equivalent hand written JNI (in the style of
+// examples/simple_app).  Every "raw JNI" result is reported right before the jni++ result it should be compared with.
+// The Java side is dev.tmich.jnipp.bench.BenchTarget, where everything is trivial.
+//
+
+static constexpr const char *kTarget = "dev.tmich.jnipp.bench.BenchTarget";
+static const std::string kShortString("short string");
+
+//
+// Raw JNI handles, looked up once directly with JNI rather than through jni++'s caches.
+//
+struct RawTarget {
+    jclass class_;
+    jobject instance;
+
+    RawTarget() {
+        jclass local = env()->FindClass("dev/tmich/jnipp/bench/BenchTarget");
+        class_ = jclass(env()->NewGlobalRef(local));
+        env()->DeleteLocalRef(local);
+
+        jmethodID ctor = env()->GetMethodID(class_, "<init>", "()V");
+        jobject localInstance = env()->NewObject(class_, ctor);
+        instance = env()->NewGlobalRef(localInstance);
+        env()->DeleteLocalRef(localInstance);
+    }
+
+    jmethodID staticMethod(const char *name, const char *signature) const {
+        return env()->GetStaticMethodID(class_, name, signature);
+    }
+    jmethodID method(const char *name, const char *signature) const {
+        return env()->GetMethodID(class_, name, signature);
+    }
+};
+
+static const RawTarget& rawTarget() {
+    static RawTarget target;
+    return target;
+}
+
+static std::string rawToString(jstring value) {
+    const char *chars = env()->GetStringUTFChars(value, nullptr);
+    std::string result(chars);
+    env()->ReleaseStringUTFChars(value, chars);
+    return result;
+}
+
+JNIPP_BENCH(MethodCalls) {
+    auto& raw = rawTarget();
+
+    jmethodID staticVoid = raw.staticMethod("staticVoid", "()V");
+    static StaticMethod<void> jStaticVoid(kTarget, "staticVoid");
+    report(runOnCurrentThread("raw JNI static void()", iterations(), [&] {
+        env()->CallStaticVoidMethod(raw.class_, staticVoid);
+    }));
+    report(runOnCurrentThread("StaticMethod<void>", iterations(), [] {
+        jStaticVoid();
+    }));
+
+    jmethodID staticInt = raw.staticMethod("staticIntMethod", "(I)I");
+    static StaticMethod<int, int> jStaticInt(kTarget, "staticIntMethod");
+    report(runOnCurrentThread("raw JNI static int(int)", iterations(), [&] {
+        doNotOptimize(env()->CallStaticIntMethod(raw.class_, staticInt, 41));
+    }));
+    report(runOnCurrentThread("StaticMethod<int, int>", iterations(), [] {
+        doNotOptimize(jStaticInt(41));
+    }));
+
+    jmethodID instanceInt = raw.method("instanceIntMethod", "(I)I");
+    static InstanceMethod<int, int> jInstanceInt(kTarget, "instanceIntMethod");
+    report(runOnCurrentThread("raw JNI instance int(int)", iterations(), [&] {
+        doNotOptimize(env()->CallIntMethod(raw.instance, instanceInt, 40));
+    }));
+    report(runOnCurrentThread("InstanceMethod<int, int>", iterations(), [&] {
+        doNotOptimize(jInstanceInt(raw.instance, 40));
+    }));
+
+    // Same Java method, with the object found through the singleton registry
+    registerSingleton(kTarget, raw.instance);
+    static SingletonMethod<int, int> jSingletonInt(kTarget, "instanceIntMethod");
+    report(runOnCurrentThread("SingletonMethod<int, int>", iterations(), [] {
+        doNotOptimize(jSingletonInt(40));
+    }));
+    unregisterSingleton(kTarget, raw.instance);
+
+    // Both return a local reference that the caller has to delete, otherwise the local reference table overflows
+    jmethodID ctor = raw.method("<init>", "(I)V");
+    static Constructor<jobject, int> jCtor(kTarget);
+    report(runOnCurrentThread("raw JNI new BenchTarget(int)", iterations() / 10, [&] {
+        jobject object = env()->NewObject(raw.class_, ctor, 5);
+        env()->DeleteLocalRef(object);
+    }));
+    report(runOnCurrentThread("Constructor<jobject, int>", iterations() / 10, [] {
+        jobject object = jCtor(5);
+        env()->DeleteLocalRef(object);
+    }));
+}
+
+JNIPP_BENCH(FieldAccess) {
+    auto& raw = rawTarget();
+
+    jfieldID staticInt = env()->GetStaticFieldID(raw.class_, "staticInt", "I");
+    static StaticField<int> jStaticInt(kTarget, "staticInt");
+    report(runOnCurrentThread("raw JNI GetStaticIntField", iterations(), [&] {
+        doNotOptimize(env()->GetStaticIntField(raw.class_, staticInt));
+    }));
+    report(runOnCurrentThread("StaticField<int>::get", iterations(), [] {
+        doNotOptimize(jStaticInt.get());
+    }));
+    report(runOnCurrentThread("raw JNI SetStaticIntField", iterations(), [&] {
+        env()->SetStaticIntField(raw.class_, staticInt, 1);
+    }));
+    report(runOnCurrentThread("StaticField<int>::set", iterations(), [] {
+        jStaticInt.set(1);
+    }));
+
+    jfieldID instanceInt = env()->GetFieldID(raw.class_, "instanceInt", "I");
+    static InstanceField<int> jInstanceInt(kTarget, "instanceInt");
+    report(runOnCurrentThread("raw JNI GetIntField", iterations(), [&] {
+        doNotOptimize(env()->GetIntField(raw.instance, instanceInt));
+    }));
+    report(runOnCurrentThread("InstanceField<int>::get", iterations(), [&] {
+        doNotOptimize(jInstanceInt.get(raw.instance));
+    }));
+    report(runOnCurrentThread("raw JNI SetIntField", iterations(), [&] {
+        env()->SetIntField(raw.instance, instanceInt, 2);
+    }));
+    report(runOnCurrentThread("InstanceField<int>::set", iterations(), [&] {
+        jInstanceInt.set(raw.instance, 2);
+    }));
+
+    registerSingleton(kTarget, raw.instance);
+    static SingletonField<int> jSingletonInt(kTarget, "instanceInt");
+    report(runOnCurrentThread("SingletonField<int>::get", iterations(), [] {
+        doNotOptimize(jSingletonInt.get());
+    }));
+    unregisterSingleton(kTarget, raw.instance);
+
+    jfieldID instanceString = env()->GetFieldID(raw.class_, "instanceString", "Ljava/lang/String;");
+    static InstanceField<std::string> jInstanceString(kTarget, "instanceString");
+    report(runOnCurrentThread("raw JNI GetObjectField String", iterations(), [&] {
+        auto value = jstring(env()->GetObjectField(raw.instance, instanceString));
+        doNotOptimize(rawToString(value));
+        env()->DeleteLocalRef(value);
+    }));
+    report(runOnCurrentThread("InstanceField<std::string>::get", iterations(), [&] {
+        doNotOptimize(jInstanceString.get(raw.instance));
+    }));
+}
+
+JNIPP_BENCH(Strings) {
+    auto& raw = rawTarget();
+
+    jmethodID stringLength = raw.staticMethod("stringLength", "(Ljava/lang/String;)I");
+    static StaticMethod<int, std::string> jStringLength(kTarget, "stringLength");
+    report(runOnCurrentThread("raw JNI int(String)", iterations(), [&] {
+        jstring value = env()->NewStringUTF(kShortString.c_str());
+        doNotOptimize(env()->CallStaticIntMethod(raw.class_, stringLength, value));
+        env()->DeleteLocalRef(value);
+    }));
+    report(runOnCurrentThread("StaticMethod<int, std::string>", iterations(), [] {
+        doNotOptimize(jStringLength(kShortString));
+    }));
+
+    jmethodID constantString = raw.staticMethod("constantString", "()Ljava/lang/String;");
+    static StaticMethod<std::string> jConstantString(kTarget, "constantString");
+    report(runOnCurrentThread("raw JNI String()", iterations(), [&] {
+        auto value = jstring(env()->CallStaticObjectMethod(raw.class_, constantString));
+        doNotOptimize(rawToString(value));
+        env()->DeleteLocalRef(value);
+    }));
+    report(runOnCurrentThread("StaticMethod<std::string>", iterations(), [] {
+        doNotOptimize(jConstantString());
+    }));
+
+    jmethodID echoString = raw.staticMethod("echoString", "(Ljava/lang/String;)Ljava/lang/String;");
+    static StaticMethod<std::string, std::string> jEchoString(kTarget, "echoString");
+    report(runOnCurrentThread("raw JNI String(String)", iterations(), [&] {
+        jstring value = env()->NewStringUTF(kShortString.c_str());
+        auto result = jstring(env()->CallStaticObjectMethod(raw.class_, echoString, value));
+        doNotOptimize(rawToString(result));
+        env()->DeleteLocalRef(result);
+        env()->DeleteLocalRef(value);
+    }));
+    report(runOnCurrentThread("StaticMethod<std::string, std::string>", iterations(), [] {
+        doNotOptimize(jEchoString(kShortString));
+    }));
+}
+
+JNIPP_BENCH(Boxed) {
+    auto& raw = rawTarget();
+
+    jclass integerClass = env()->FindClass("java/lang/Integer");
+    jmethodID valueOf = env()->GetStaticMethodID(integerClass, "valueOf", "(I)Ljava/lang/Integer;");
+    jmethodID intValue = env()->GetMethodID(integerClass, "intValue", "()I");
+
+    jmethodID boxedIncrement = raw.staticMethod("boxedIncrement", "(Ljava/lang/Integer;)Ljava/lang/Integer;");
+    static StaticMethod<jboxedint, jboxedint> jBoxedIncrement(kTarget, "boxedIncrement");
+    report(runOnCurrentThread("raw JNI Integer(Integer)", iterations(), [&] {
+        jobject boxed = env()->CallStaticObjectMethod(integerClass, valueOf, 41);
+        jobject result = env()->CallStaticObjectMethod(raw.class_, boxedIncrement, boxed);
+        doNotOptimize(env()->CallIntMethod(result, intValue));
+        env()->DeleteLocalRef(result);
+        env()->DeleteLocalRef(boxed);
+    }));
+    report(runOnCurrentThread("StaticMethod<jboxedint, jboxedint>", iterations(), [] {
+        doNotOptimize(jBoxedIncrement(41));
+    }));
+
+    jfieldID boxedInt = env()->GetFieldID(raw.class_, "boxedInt", "Ljava/lang/Integer;");
+    static InstanceField<jboxedint> jBoxedInt(kTarget, "boxedInt");
+    report(runOnCurrentThread("raw JNI GetObjectField Integer", iterations(), [&] {
+        jobject boxed = env()->GetObjectField(raw.instance, boxedInt);
+        doNotOptimize(env()->CallIntMethod(boxed, intValue));
+        env()->DeleteLocalRef(boxed);
+    }));
+    report(runOnCurrentThread("InstanceField<jboxedint>::get", iterations(), [&] {
+        doNotOptimize(jBoxedInt.get(raw.instance));
+    }));
+
+    env()->DeleteLocalRef(integerClass);
+}
+
+JNIPP_BENCH(Arrays) {
+    auto& raw = rawTarget();
+    constexpr int kLength = 64;
+    int values[kLength];
+    for (int i = 0; i < kLength; ++i) {
+        values[i] = i;
+    }
+
+    jmethodID sumInts = raw.staticMethod("sumInts", "([I)I");
+    static StaticMethod<int, jobject> jSumInts(kTarget, "sumInts", "([I)I");
+    report(runOnCurrentThread("raw JNI int[64] to Java", iterations() / 10, [&] {
+        jintArray array = env()->NewIntArray(kLength);
+        env()->SetIntArrayRegion(array, 0, kLength, values);
+        doNotOptimize(env()->CallStaticIntMethod(raw.class_, sumInts, array));
+        env()->DeleteLocalRef(array);
+    }));
+    report(runOnCurrentThread("PrimitiveArray<int>::convert int[64] to Java", iterations() / 10, [&] {
+        jintArray array = PrimitiveArray<int>::convert<jobject>(values, kLength);
+        doNotOptimize(jSumInts(array));
+        env()->DeleteLocalRef(array);
+    }));
+
+    jintArray javaInts = env()->NewIntArray(kLength);
+    env()->SetIntArrayRegion(javaInts, 0, kLength, values);
+    report(runOnCurrentThread("raw JNI Get/ReleaseIntArrayElements", iterations(), [&] {
+        jint *elements = env()->GetIntArrayElements(javaInts, nullptr);
+        doNotOptimize(elements[kLength - 1]);
+        env()->ReleaseIntArrayElements(javaInts, elements, JNI_ABORT);
+    }));
+    report(runOnCurrentThread("PrimitiveArray<int>::get/release", iterations(), [&] {
+        int *elements = PrimitiveArray<int>::get(javaInts);
+        doNotOptimize(elements[kLength - 1]);
+        PrimitiveArray<int>::release(javaInts, elements);
+    }));
+    report(runOnCurrentThread("ArrayElements<int> read only", iterations(), [&] {
+        ArrayElements<int> elements(javaInts);
+        doNotOptimize(elements[kLength - 1]);
+    }));
+    report(runOnCurrentThread("CriticalArray<int> read only", iterations(), [&] {
+        CriticalArray<int> elements(javaInts);
+        doNotOptimize(elements[kLength - 1]);
+    }));
+    report(runOnCurrentThread("PrimitiveArray<int>::getRegion 1 element", iterations(), [&] {
+        int last;
+        PrimitiveArray<int>::getRegion(javaInts, kLength - 1, 1, &last);
+        doNotOptimize(last);
+    }));
+    env()->DeleteLocalRef(javaInts);
+
+    constexpr int kStrings = 8;
+    jclass stringClass = env()->FindClass("java/lang/String");
+    jmethodID countStrings = raw.staticMethod("countStrings", "([Ljava/lang/String;)I");
+    static ObjectArray<std::string> jStrings("java.lang.String");
+    static StaticMethod<int, jobject> jCountStrings(kTarget, "countStrings", "([Ljava/lang/String;)I");
+    report(runOnCurrentThread("raw JNI String[8] to Java", iterations() / 10, [&] {
+        jobjectArray array = env()->NewObjectArray(kStrings, stringClass, nullptr);
+        for (int i = 0; i < kStrings; ++i) {
+            jstring value = env()->NewStringUTF(kShortString.c_str());
+            env()->SetObjectArrayElement(array, i, value);
+            env()->DeleteLocalRef(value);
+        }
+        doNotOptimize(env()->CallStaticIntMethod(raw.class_, countStrings, array));
+        env()->DeleteLocalRef(array);
+    }));
+    report(runOnCurrentThread("ObjectArray<std::string> String[8] to Java", iterations() / 10, [&] {
+        jobjectArray array = jStrings.create<jobject>(kStrings);
+        for (int i = 0; i < kStrings; ++i) {
+            jStrings.set(array, i, kShortString);
+        }
+        doNotOptimize(jCountStrings(array));
+        env()->DeleteLocalRef(array);
+    }));
+    env()->DeleteLocalRef(stringClass);
+}
@@ -0,0 +1,42 @@
+//
+// EnvScalingBench.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "BenchHarness.hpp"
+
+using namespace jni_pp;
+using namespace jni_pp::bench;
+
+static const int kThreadCounts[] = {1, 2, 4, 8, 16, 32};
+
+//
+// env() by itself.  Once a thread has its JNIEnv cached this should not touch any shared state, so ops/s/thread
+// should be (roughly) the same for every thread count.
+//
+JNIPP_BENCH(EnvScaling) {
+    for (int threads : kThreadCounts) {
+        report(runOnThreads("env()", threads, iterations(), [] {
+            doNotOptimize(env());
+        }));
+    }
+}
+
+//
+// A full StaticMethod invocation calls env() several times per call (frame push/pop, the call itself, exception
+// check, ...).  Math.abs keeps the Java side trivial so the native overhead dominates.
+//
+JNIPP_BENCH(StaticMethodScaling) {
+    static StaticMethod<int, int> jAbs("java.lang.Math", "abs", "(I)I");
+    for (int threads : kThreadCounts) {
+        report(runOnThreads("StaticMethod<int, int> Math.abs", threads, iterations() / 10, [] {
+            doNotOptimize(jAbs(-42));
+        }));
+    }
+}
@@ -0,0 +1,49 @@
+//
+// LocalFrameBench.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "BenchHarness.hpp"
+
+using namespace jni_pp;
+using namespace jni_pp::bench;
+
+//
+// Cost of the PushLocalFrame/PopLocalFrame round trip that all-primitive signatures no longer pay.  The two raw JNI
+// variants bracket what StaticMethod<int, int> can achieve: with NeedsLocalFrame it should track the frameless one.
+//
+JNIPP_BENCH(LocalFrame) {
+    static StaticMethod<int, int> jAbs("java.lang.Math", "abs", "(I)I");
+    static StaticMethod<long, long, long> jMax("java.lang.Math", "max", "(JJ)J");
+
+    jclass mathClass = jAbs.getMethodInfo()->class_;
+    jmethodID absMethod = jAbs.getMethodInfo()->methodID;
+
+    report(runOnCurrentThread("raw JNI Math.abs, no frame", iterations(), [&] {
+        jvalue arg;
+        arg.i = -42;
+        doNotOptimize(env()->CallStaticIntMethodA(mathClass, absMethod, &arg));
+    }));
+
+    report(runOnCurrentThread("raw JNI Math.abs, Push/PopLocalFrame", iterations(), [&] {
+        env()->PushLocalFrame(2);
+        jvalue arg;
+        arg.i = -42;
+        doNotOptimize(env()->CallStaticIntMethodA(mathClass, absMethod, &arg));
+        env()->PopLocalFrame(nullptr);
+    }));
+
+    report(runOnCurrentThread("StaticMethod<int, int> Math.abs", iterations(), [] {
+        doNotOptimize(jAbs(-42));
+    }));
+
+    report(runOnCurrentThread("StaticMethod<long, long, long> Math.max", iterations(), [] {
+        doNotOptimize(jMax(-42, 42));
+    }));
+}
@@ -0,0 +1,66 @@
+//
+// StringArrayBench.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <algorithm>
+
+#include "BenchHarness.hpp"
+#include "jnipp/Strings.hpp"
+
+using namespace jni_pp;
+using namespace jni_pp::bench;
+
+static const size_t kArraySizes[] = {10, 1000, 10000};
+
+//
+// String[] to and from std::vector<std::string>, element by element through ObjectArray<std::string> against the
+// bulk conversions that pack the whole array into one byte[].  Iterations are scaled down by the array size so each
+// measurement converts about the same number of strings, ns/op is per array.
+//
+JNIPP_BENCH(StringArray) {
+    static ObjectArray<std::string> jStrings("java.lang.String");
+
+    for (size_t size : kArraySizes) {
+        std::vector<std::string> values;
+        for (size_t i = 0; i < size; ++i) {
+            values.push_back("value " + std::to_string(i));
+        }
+        auto count = std::max<uint64_t>(1, iterations() / size);
+        auto suffix = " (" + std::to_string(size) + " strings)";
+
+        JniLocalReferenceScope refs(16);
+        jobjectArray array = vectorToJStringArray(values);
+
+        report(runOnCurrentThread("ObjectArray<std::string>::get per element" + suffix, count, [&] {
+            std::vector<std::string> result(size);
+            for (size_t i = 0; i < size; ++i) {
+                result[i] = jStrings.get(array, int(i));
+            }
+            doNotOptimize(result);
+        }));
+
+        report(runOnCurrentThread("jStringArrayToVector" + suffix, count, [&] {
+            doNotOptimize(jStringArrayToVector(array));
+        }));
+
+        report(runOnCurrentThread("ObjectArray<std::string>::set per element" + suffix, count, [&] {
+            jobjectArray result = jStrings.create<jobject>(int(size));
+            for (size_t i = 0; i < size; ++i) {
+                jStrings.set(result, int(i), values[i]);
+            }
+            env()->DeleteLocalRef(result);
+        }));
+
+        report(runOnCurrentThread("vectorToJStringArray" + suffix, count, [&] {
+            jobjectArray result = vectorToJStringArray(values);
+            env()->DeleteLocalRef(result);
+        }));
+    }
+}
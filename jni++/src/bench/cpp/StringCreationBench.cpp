@@ -0,0 +1,59 @@
+//
+// StringCreationBench.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "BenchHarness.hpp"
+
+using namespace jni_pp;
+using namespace jni_pp::bench;
+
+static const size_t kLengths[] = {8, 64, 512, 4096, 65536};
+
+//
+// Building a java.lang.String from a std::string across lengths.  NewStringUTF is what the conversion used to do,
+// toJString takes the ASCII route (checked in blocks then widened) for the first input and transcodes the second,
+// which has a two byte character every 32 bytes.  Raw NewString of an already widened string is the floor.
+//
+JNIPP_BENCH(StringCreation) {
+    for (size_t length : kLengths) {
+        std::string ascii(length, 'a');
+        std::string mixed;
+        while (mixed.size() + 2 <= length) {
+            mixed.append(mixed.size() % 32 == 0 ? "\xC3\xA9" : "b");
+        }
+        std::u16string widened(length, u'a');
+        auto suffix = " (" + std::to_string(length) + " bytes)";
+
+        report(runOnCurrentThread("raw JNI NewStringUTF, ASCII" + suffix, iterations(), [&] {
+            jstring s = env()->NewStringUTF(ascii.c_str());
+            env()->DeleteLocalRef(s);
+        }));
+
+        report(runOnCurrentThread("raw JNI NewString, pre-widened" + suffix, iterations(), [&] {
+            jstring s = env()->NewString(reinterpret_cast<const jchar *>(widened.data()), jsize(widened.size()));
+            env()->DeleteLocalRef(s);
+        }));
+
+        report(runOnCurrentThread("toJString, ASCII" + suffix, iterations(), [&] {
+            jstring s = toJString(ascii.data(), ascii.size());
+            env()->DeleteLocalRef(s);
+        }));
+
+        report(runOnCurrentThread("raw JNI NewStringUTF, non-ASCII" + suffix, iterations(), [&] {
+            jstring s = env()->NewStringUTF(mixed.c_str());
+            env()->DeleteLocalRef(s);
+        }));
+
+        report(runOnCurrentThread("toJString, non-ASCII" + suffix, iterations(), [&] {
+            jstring s = toJString(mixed.data(), mixed.size());
+            env()->DeleteLocalRef(s);
+        }));
+    }
+}
@@ -0,0 +1,48 @@
+//
+// dev.tmich.jnipp.bench.BenchTarget.java
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+package dev.tmich.jnipp.bench;
+
+//
+// Java side of jni++_bench.  Everything here is trivial so the measurements are dominated by the cost of getting
+// into and out of Java, which is what is being compared (jni++ vs. raw JNI).
+//
+@SuppressWarnings("unused")  // Only called from native code
+public class BenchTarget {
+    public static int staticInt = 1;
+    public static String staticString = "static field";
+
+    public int instanceInt = 2;
+    public String instanceString = "instance field";
+    public Integer boxedInt = 3;
+
+    public BenchTarget() {}
+    public BenchTarget(int value) { instanceInt = value; }
+
+    public static void staticVoid() {}
+    public static int staticIntMethod(int value) { return value + 1; }
+    public int instanceIntMethod(int value) { return instanceInt + value; }
+
+    public static String echoString(String value) { return value; }
+    public static int stringLength(String value) { return value.length(); }
+    public static String constantString() { return "a constant string returned to native code"; }
+
+    public static Integer boxedIncrement(Integer value) { return value + 1; }
+
+    public static int sumInts(int[] values) {
+        int sum = 0;
+        for (int value : values) {
+            sum += value;
+        }
+        return sum;
+    }
+    public static int countStrings(String[] values) { return values.length; }
+}
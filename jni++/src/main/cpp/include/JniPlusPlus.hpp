@@ -22,20 +22,26 @@
 
 #include <jni.h>
 
+#include <array>
 #include <memory>
 #include <cstring>
+#include <functional>
 #include <mutex>
 #include <typeinfo>
 #include <typeindex>
 #include <map>
-#include <sstream>
+#include <span>
+#include <string_view>
+#include <vector>
 #include <iostream>
 
 #include "jnipp/Utilities.hpp"
+#include "jnipp/Bindings.hpp"
 #include "jnipp/Converters.hpp"
 #include "jnipp/InvokersLowLevel.hpp"
 #include "jnipp/InvokersHighLevel.hpp"
 #include "jnipp/References.hpp"
+#include "jnipp/Singletons.hpp"
 #include "jnipp/Loggers.hpp"
 
 namespace jni_pp {
@@ -47,10 +53,21 @@ namespace jni_pp {
 /// @tparam Args Variadic list of method parameter types.  In some cases (for example an instance method) the
 /// first type will be the jobject reference to the target java object.
 template <typename ReturnType, typename... Args>
-class Method {
+class Method : public Binding {
 public:
 	virtual ~Method() = default;
 
+    /// @brief Resolve the method now rather than on first call (see warmup()).
+    void resolve() override {
+        getMethodInfo();
+    }
+
+    /// @brief Describe the method for resolveMembers (see warmup()).
+    bool describeMember(MemberRequest& request) override {
+        request = MemberRequest{getClassName(), methodName, std::string(methodSignature), isStaticMember(), numParameters};
+        return true;
+    }
+
     /// @brief Take the passed in JVM class name and return the full class name.
     ///
     /// Applies rules such as applying a default package and/or swig mappings to determine the canonical class name.
@@ -67,8 +84,10 @@ public:
     /// The actual lookup is only performed the first time and cached.  Each instance caches the results in the Mehtod
     /// object but, if you have more than one Method object that refers to the same JVM method, the results are also
     /// cached globally.  The returned structure includes the jclass and jmethodID for the method.
-    /// @return Pointer to MethodInfo struct.  Will never be nullptr, currently aborts if method or class cannot be found.
+    /// @return Pointer to MethodInfo struct.  Will never be nullptr.  Throws resolution_error if the method or class
+    /// cannot be found, in which case nothing is cached and the lookup is tried again on the next call.
 	MethodInfo* getMethodInfo() {
+		// A throwing lookup leaves the once_flag unset
 		call_once(runMIOnce, [&]{
             methodInfo = getMethodInfoInternal();
         });
@@ -81,7 +100,23 @@ public:
     /// type specific invocation logic.
     /// @param args The arguments to pass to the JVM method
     /// @return The value returned by the JVM method, converted to the ReturnType C++ type.
-	typename JniTypeMapping<ReturnType>::actualCppType operator()(typename JniTypeMapping<Args>::actualCppType ...args);
+	typename JniTypeMapping<ReturnType>::actualCppType operator()(typename JniArgumentType<Args>::type ...args);
+
+    /// @brief Call a method returning a String, converting the result into out instead of a new string.
+    ///
+    /// out is sized exactly and keeps its capacity, so calling repeatedly with the same out stops allocating once it
+    /// is big enough.  Takes std::string or std::pmr::string, for example one backed by a monotonic_buffer_resource
+    /// arena that is released all at once.
+    /// @param out Replaced with the returned string.  Empty if the method returned null.
+    /// @param args The arguments to pass to the JVM method
+    template <typename OutString>
+    void call_into(OutString& out, typename JniArgumentType<Args>::type ...args);
+
+    /// @brief Call a method returning a String, converting the result into a caller provided buffer.
+    ///
+    /// See jStringToBuffer.  Replaces the strdup of a char * return.
+    /// @return The length of the returned string in UTF-8.  It was only written if less than size.
+    size_t call_into(char *buffer, size_t size, typename JniArgumentType<Args>::type ...args);
 
 protected:
 
@@ -92,42 +127,35 @@ protected:
     /// @return Pointer to MethodInfo struct which contains the jclass and jmethodID.
     virtual MethodInfo* getMethodInfoInternal() = 0;
 
+    /// @brief Whether the JVM method is static, passed to getMethodInfo by the implementing class.
+    virtual bool isStaticMember() const {
+        return false;
+    }
+
     /// @brief Method constructor only visible to implementing classes.
     /// @param className Name of the JVM class
     /// @param methodName Name of the JVM method
     /// @param signature JNI signature which can be empty
-    /// @param isStatic Is this a static method
+    /// @param computedSignature Signature computed at compile time from the C++ types (see JniMethodSignature).  Must
+    /// refer to static storage.  Used when signature is empty.
     /// @param numReservedParameters How many parameters are used by the implementation and not passed to the JVM method.  Generally, 0 or 1 depending
     /// on if there is an instance object being passed in as the first parameter.
-    Method(const std::string& className, const std::string& methodName, const std::string& signature, const std::string& returnSignature, int numReservedParameters) :
-            givenClassName(className), methodName(methodName), methodSignature(signature), numReservedParameters(numReservedParameters)
+    Method(const std::string& className, const std::string& methodName, const std::string& signature, std::string_view computedSignature, int numReservedParameters) :
+            givenClassName(className), methodName(methodName), givenSignature(signature), computedSignature(computedSignature),
+            numParameters(int(sizeof...(Args)) - numReservedParameters), numReservedParameters(numReservedParameters)
     {
-        std::stringstream sigbuf{};
-        std::vector<std::string> returnType;
-
-        sigbuf << "(";
-        GatherSignature<Args...>::gather(sigbuf, parameterJniTypeNames, numReservedParameters);
-        sigbuf << ")";
-        if (returnSignature.empty()) {
-            GatherSignature<ReturnType>::gather(sigbuf, returnType, 0);
-        } else {
-            sigbuf << returnSignature;
-        }
-        computedSignature = sigbuf.str();
-        if (methodSignature.empty()) {
-            methodSignature = computedSignature;
-        }
-
-        getLogger()->debug( "Signature for " + className + "." + methodName + ": " + computedSignature );
+        methodSignature = givenSignature.empty() ? computedSignature : std::string_view(givenSignature);
     }
 
     /// @brief Invoke the refered to JVM method with the given arguments and return the converted results.
     ///
-    ///
-    /// @param javaArgs
-    /// @param refs
-    /// @return
-    virtual typename JniTypeMapping<ReturnType>::actualCppType invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs) = 0;
+    /// @param javaArgs The converted arguments, one for each of Args (including any reserved parameters)
+    /// @param refs The local reference scope of the call, see JvmObjectPassThrough
+    /// @return The value returned by the JVM method, converted to the ReturnType C++ type.
+    virtual typename JniTypeMapping<ReturnType>::actualCppType invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs) = 0;
+
+    /// @brief Invoke the JVM method and return its result as a local reference, without converting it.  Used by call_into.
+    virtual jobject invokeForObject(const jvalue* javaArgs) = 0;
 
 private:
     static const std::string calculateClassName(const std::string& given) {
@@ -147,9 +175,9 @@ protected:
     const std::string givenClassName;
     const std::string methodName;
 
-    std::string methodSignature;
-    std::string computedSignature;
-    std::vector<std::string> parameterJniTypeNames;
+    const std::string givenSignature;
+    std::string_view computedSignature;
+    std::string_view methodSignature;
 
     int numParameters;
     int numReservedParameters;
@@ -169,15 +197,24 @@ public:
     typedef Method<ReturnType, Args...> Base;
     using Base::getClassName, Base::getMethodInfo, Base::methodName, Base::methodSignature, Base::numParameters;
 
-	StaticMethod(const std::string& className, const std::string& methodName, const std::string& signature = "") : Method<ReturnType, Args...>(className, methodName, signature, "", 0) {}
-	virtual ~StaticMethod() {}
+	StaticMethod(const std::string& className, const std::string& methodName, const std::string& signature = "") : Method<ReturnType, Args...>(className, methodName, signature, JniMethodSignature<ReturnType, Args...>::value.view(), 0) {
+        registerBinding(this);
+    }
+	virtual ~StaticMethod() {
+        unregisterBinding(this);
+    }
 
 protected:
     MethodInfo* getMethodInfoInternal() {
         return  jni_pp::getMethodInfo(getClassName(), methodName, methodSignature, true, numParameters);
     }
 
-    typename JniTypeMapping<ReturnType>::actualCppType invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs);
+    bool isStaticMember() const override {
+        return true;
+    }
+
+    typename JniTypeMapping<ReturnType>::actualCppType invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs);
+    jobject invokeForObject(const jvalue* javaArgs) override;
 };
 
 
@@ -190,16 +227,21 @@ public:
     using Base::getClassName, Base::getMethodInfo, Base::methodName, Base::methodSignature, Base::numParameters;
 
 	InstanceMethod(const std::string& className, const std::string& methodName, const std::string& signature = "") :
-        Method<ReturnType, jobject, Args...>(className, methodName, signature, "", 1)
-        {}
-	virtual ~InstanceMethod() {}
+        Method<ReturnType, jobject, Args...>(className, methodName, signature, JniMethodSignature<ReturnType, Args...>::value.view(), 1)
+    {
+        registerBinding(this);
+    }
+	virtual ~InstanceMethod() {
+        unregisterBinding(this);
+    }
 
 protected:
     MethodInfo* getMethodInfoInternal() {
         return  jni_pp::getMethodInfo(getClassName(), methodName, methodSignature, false, numParameters);
     }
 
-    typename JniTypeMapping<ReturnType>::actualCppType invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs);
+    typename JniTypeMapping<ReturnType>::actualCppType invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs);
+    jobject invokeForObject(const jvalue* javaArgs) override;
 };
 
 template <typename ReturnType, typename... Args>
@@ -210,16 +252,21 @@ public:
     using Base::getClassName, Base::getMethodInfo, Base::methodName, Base::methodSignature, Base::numParameters;
 
     SingletonMethod(const std::string& className, const std::string& methodName, const std::string& signature = "") :
-        Method<ReturnType, Args...>(className, methodName, signature, "", 0)
-        {}
-    virtual ~SingletonMethod() {}
+        Method<ReturnType, Args...>(className, methodName, signature, JniMethodSignature<ReturnType, Args...>::value.view(), 0)
+    {
+        registerBinding(this);
+    }
+    virtual ~SingletonMethod() {
+        unregisterBinding(this);
+    }
 
 protected:
     MethodInfo* getMethodInfoInternal() {
         return  jni_pp::getMethodInfo(getClassName(), methodName, methodSignature, false, numParameters);
     }
 
-    typename JniTypeMapping<ReturnType>::actualCppType invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs);
+    typename JniTypeMapping<ReturnType>::actualCppType invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs);
+    jobject invokeForObject(const jvalue* javaArgs) override;
 };
 
 template <typename ReturnType, typename... Args>
@@ -229,21 +276,41 @@ public:
 	typedef Method<ReturnType, Args...> Base;
     using Base::getClassName, Base::getMethodInfo, Base::methodName, Base::methodSignature, Base::numParameters;
 
-	Constructor(const std::string& className, const std::string& signature = "") : Method<ReturnType, Args...>(className, "<init>", signature, "V", 0) {}
-	virtual ~Constructor() {}
+	Constructor(const std::string& className, const std::string& signature = "") : Method<ReturnType, Args...>(className, "<init>", signature, JniMethodSignature<void, Args...>::value.view(), 0) {
+        registerBinding(this);
+    }
+	virtual ~Constructor() {
+        unregisterBinding(this);
+    }
 
 protected:
     MethodInfo* getMethodInfoInternal() {
         return  jni_pp::getMethodInfo(getClassName(), methodName, methodSignature, false, numParameters);
     }
 
-    jobject invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs);
+    jobject invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs);
+    jobject invokeForObject(const jvalue* javaArgs) override;
 };
 
+// Local frame capacity used by field accessors when a frame is needed
+constexpr int kFieldFrameCapacity = 16;
+
 template <typename FieldType>
-class Field {
+class Field : public Binding {
 public:
-    
+
+    /// @brief Resolve the field now rather than on first access (see warmup()).
+    void resolve() override {
+        getFieldInfo();
+    }
+
+    /// @brief Describe the field for resolveMembers (see warmup()).
+    bool describeMember(MemberRequest& request) override {
+        request = MemberRequest{className, fieldName, fieldSignature, isStatic, -1};
+        return true;
+    }
+
+    // Throws resolution_error if the field can't be found.  The once_flag is left unset so it is looked up again.
     FieldInfo* getFieldInfo() {
         call_once(runOnce, [&]{
             fieldInfo = jni_pp::getFieldInfo(className, fieldName, fieldSignature, isStatic);
@@ -275,11 +342,14 @@ public:
     using Base::getFieldInfo;
 
     InstanceField(const std::string& className, const std::string& fieldName, const std::string& fieldSignature = "") : Field<FieldType>(className, fieldName, fieldSignature, false) {
+        registerBinding(this);
+    }
+    ~InstanceField() {
+        unregisterBinding(this);
     }
-    ~InstanceField() {}
 
     typename JniTypeMapping<FieldType>::actualCppType get(jobject object);
-    void set(jobject object, typename JniTypeMapping<FieldType>::actualCppType value);
+    void set(jobject object, typename JniArgumentType<FieldType>::type value);
 };
 
 template <typename FieldType>
@@ -292,11 +362,15 @@ public:
 
     SingletonField(const std::string& className, const std::string& fieldName, const std::string& fieldSignature = "") :
         Field<FieldType>(className, fieldName, fieldSignature, false)
-        {}
-    ~SingletonField() {}
+    {
+        registerBinding(this);
+    }
+    ~SingletonField() {
+        unregisterBinding(this);
+    }
 
     typename JniTypeMapping<FieldType>::actualCppType get();
-    void set(typename JniTypeMapping<FieldType>::actualCppType value);
+    void set(typename JniArgumentType<FieldType>::type value);
 };
 
 template <typename FieldType>
@@ -307,14 +381,44 @@ public:
     using Base::getFieldInfo;
 
     StaticField(const std::string& className, const std::string& fieldName, const std::string& fieldSignature = "") : Field<FieldType>(className, fieldName, fieldSignature, true) {
+        registerBinding(this);
+    }
+    ~StaticField() {
+        unregisterBinding(this);
     }
-    ~StaticField() {}
 
     typename JniTypeMapping<FieldType>::actualCppType get();
-    void set(typename JniTypeMapping<FieldType>::actualCppType value);
+    void set(typename JniArgumentType<FieldType>::type value);
 };
 
 
+//
+// Chunked transfers split a large region copy into chunks of chunkElements, copied by up to threads threads: the
+// caller and workers attached to the JVM for the transfer, each making its own region copies.  A single region copy
+// of a very large array runs on one core; split up, the copy can use the memory bandwidth of several.  Small
+// transfers (one chunk) are copied on the calling thread.
+//
+// progress, if set, is called after each chunk with the elements copied so far and the total.  It runs on whichever
+// transfer thread copied the chunk, often a worker rather than the caller, but never concurrently.  So it must not
+// use the caller's local references or thread locals.  Returning false cancels the transfer: chunks already being
+// copied finish, no new ones start.
+//
+// An exception on any thread (a Java exception from a copy, or one thrown by progress) stops the transfer.  The first
+// one is rethrown on the calling thread after all the workers have finished and detached.
+//
+using ArrayTransferProgress = std::function<bool(size_t copied, size_t total)>;
+
+constexpr size_t kDefaultTransferChunkElements = 1024 * 1024;
+
+typedef struct ArrayTransferOptions {
+    size_t chunkElements = kDefaultTransferChunkElements;
+    unsigned threads = 0;           // 0 for one per core, at most 8
+    ArrayTransferProgress progress;
+} ArrayTransferOptions;
+
+// Runs copyChunk(offset, count) over [0, total) as described above.  Returns false if cancelled.
+bool runChunkedTransfer(size_t total, const ArrayTransferOptions& options, const std::function<void(size_t offset, size_t count)>& copyChunk);
+
 template <typename CppElementType>
 class PrimitiveArray {
 public:
@@ -334,23 +438,175 @@ public:
 
     static void set(ArrayType javaArray, CppElementType cppArray[], int len);
     static void set(ArrayType javaArray, CppElementType cppArray[], int start, int len);
+    static void set(ArrayType javaArray, int start, std::span<const CppElementType> values);
+
+    //
+    // Copy len elements starting at start out of the Java array (Get<Type>ArrayRegion).  Unlike get()/release() only
+    // the requested elements are copied and nothing is ever written back.  Throws if the range is out of bounds.
+    //
+    static void getRegion(ArrayType javaArray, int start, int len, CppElementType out[]);
+    static void getRegion(ArrayType javaArray, int start, std::span<CppElementType> out);
+
+    static std::vector<CppElementType> toVector(ArrayType javaArray);
+    static std::vector<CppElementType> toVector(ArrayType javaArray, int start, int len);
 
+    //
+    // Chunked region copies (see ArrayTransferOptions) for very large arrays.  Throws std::runtime_error if the range
+    // is out of bounds, or rethrows the first exception raised during the transfer.  Returns false if the transfer
+    // was cancelled, with only some of the chunks copied.
+    //
+    static bool getRegionChunked(ArrayType javaArray, int start, std::span<CppElementType> out, const ArrayTransferOptions& options = {});
+    static bool setRegionChunked(ArrayType javaArray, int start, std::span<const CppElementType> values, const ArrayTransferOptions& options = {});
+
+    //
+    // Raw access to the elements.  mode is passed to the JNI release function: 0 (copy back and free), JNI_COMMIT or
+    // JNI_ABORT.  Prefer ArrayElements and CriticalArray, which can't be leaked and make read only access explicit.
+    //
     static CppElementType* get(ArrayType array, bool* isCopy = nullptr);
-    static void release(ArrayType array, CppElementType* arrayPointer);
+    static void release(ArrayType array, CppElementType* arrayPointer, jint mode = 0);
 
     static CppElementType* getCritical(ArrayType array, bool* isCopy = nullptr);
-    static void releaseCritical(ArrayType array, CppElementType* arrayPointer);
+    static void releaseCritical(ArrayType array, CppElementType* arrayPointer, jint mode = 0);
 
     static int size(ArrayType array);
 };
 
+//
+// How ArrayElements and CriticalArray give the elements back.  If the JVM handed out a copy, read only access frees
+// it without copying it back (JNI_ABORT), so large read only scans never pay for the write back.  Read write access
+// copies changes back when the guard is released.
+//
+typedef enum ArrayAccess {
+    ARRAY_READ_ONLY,
+    ARRAY_READ_WRITE
+} ArrayAccess;
+
+//
+// Scoped Get<Type>ArrayElements / Release<Type>ArrayElements.  The elements are a std::span, const for read only
+// access:
+//
+//     ArrayElements<int> samples(javaSamples);    // read only
+//     long total = std::accumulate(samples.begin(), samples.end(), 0L);
+//
+//     ArrayElements<float, ARRAY_READ_WRITE> pixels(javaPixels);
+//     std::fill(pixels.begin(), pixels.end(), 0.0f);
+//     pixels.commit();        // Java sees the change now, not just when pixels is released
+//
+template <typename CppElementType, ArrayAccess access = ARRAY_READ_ONLY>
+class ArrayElements {
+public:
+    using ArrayType = typename PrimitiveArray<CppElementType>::ArrayType;
+    using ElementType = std::conditional_t<access == ARRAY_READ_ONLY, const CppElementType, CppElementType>;
+
+    explicit ArrayElements(ArrayType array);
+    ArrayElements(ArrayElements&& other) noexcept;
+    ArrayElements(const ArrayElements&) = delete;
+    ArrayElements& operator=(const ArrayElements&) = delete;
+    ~ArrayElements() {
+        release();
+    }
+
+    std::span<ElementType> span() const { return std::span<ElementType>(elements, length); }
+    ElementType* data() const { return elements; }
+    size_t size() const { return length; }
+    ElementType* begin() const { return elements; }
+    ElementType* end() const { return elements + length; }
+    ElementType& operator[](size_t index) const { return elements[index]; }
+
+    // Did the JVM hand out a copy rather than the array itself
+    bool isCopy() const { return copy; }
+
+    // Copy changes back to the Java array now (JNI_COMMIT) and keep the elements
+    void commit();
+
+    // Give the elements back early, according to access.  Nothing may be used after this.
+    void release();
+
+private:
+    ArrayType array;
+    ElementType* elements;
+    size_t length;
+    bool copy = false;
+};
+
+//
+// Scoped GetPrimitiveArrayCritical / ReleasePrimitiveArrayCritical.  Usually a pointer into the Java array itself, with
+// no copy in either direction, but while it is held the GC may be held off and no other JNI calls may be made on the
+// thread.  Keep the scope tight, just around the loop that needs the elements.
+//
+template <typename CppElementType, ArrayAccess access = ARRAY_READ_ONLY>
+class CriticalArray {
+public:
+    using ArrayType = typename PrimitiveArray<CppElementType>::ArrayType;
+    using ElementType = std::conditional_t<access == ARRAY_READ_ONLY, const CppElementType, CppElementType>;
+
+    explicit CriticalArray(ArrayType array);
+    CriticalArray(CriticalArray&& other) noexcept;
+    CriticalArray(const CriticalArray&) = delete;
+    CriticalArray& operator=(const CriticalArray&) = delete;
+    ~CriticalArray() {
+        release();
+    }
+
+    std::span<ElementType> span() const { return std::span<ElementType>(elements, length); }
+    ElementType* data() const { return elements; }
+    size_t size() const { return length; }
+    ElementType* begin() const { return elements; }
+    ElementType* end() const { return elements + length; }
+    ElementType& operator[](size_t index) const { return elements[index]; }
+
+    bool isCopy() const { return copy; }
+
+    // Copy changes back to the Java array now (JNI_COMMIT) and keep the elements
+    void commit();
+
+    // Leave the critical region early, according to access
+    void release();
+
+private:
+    ArrayType array;
+    ElementType* elements;
+    size_t length;
+    bool copy = false;
+};
+
+//
+// std::vector, std::span and std::array of primitives can be used directly as argument, return and field types for
+// Java primitive arrays, so "int[] compute(float[])" is simply:
+//
+//     StaticMethod<std::vector<int>, std::span<const float>> jCompute("com.example.Signal", "compute");
+//     std::vector<int> result = jCompute(samples);
+//
+// Each conversion is a single region copy into storage sized up front: New<Type>Array + Set<Type>ArrayRegion to
+// Java, Get<Type>ArrayRegion back.  A null Java array is an empty vector.  std::array must match the Java array's
+// length exactly or std::runtime_error is thrown.  Spans are argument (and field set) only, like string views.
+//
+// Elements are the C++ types the primitives map to: bool, unsigned char (byte), short, int, long, long long, float
+// and double.  char maps to Java's 16 bit char, so it can't be copied as a region and isn't supported.
+//
+template <typename CppElementType>
+concept PrimitiveArrayElement = std::is_same_v<CppElementType, bool> || std::is_same_v<CppElementType, unsigned char> ||
+        std::is_same_v<CppElementType, short> || std::is_same_v<CppElementType, int> ||
+        std::is_same_v<CppElementType, long> || std::is_same_v<CppElementType, long long> ||
+        std::is_same_v<CppElementType, float> || std::is_same_v<CppElementType, double>;
+
 template <typename CppElementType>
-class ObjectArray {
+class ObjectArray : public Binding {
 public:
 
     ObjectArray(const std::string& className) : className(className) {
+        registerBinding(this);
+    }
+    ~ObjectArray() {
+        unregisterBinding(this);
+    }
+
+    /// @brief Resolve the element class now rather than on first use (see warmup()).
+    void resolve() override {
+        getClass();
     }
 
+    // Throws resolution_error if the class can't be found.  The once_flag is left unset so it is looked up again.
     jclass getClass() {
         call_once(runOnce, [&]{
             class_ = jni_pp::getClass(className);
@@ -365,7 +621,7 @@ public:
 
     typename JniTypeMapping<CppElementType>::actualCppType get(jobjectArray array, int index);
 
-    void set(jobjectArray array, int index, typename JniTypeMapping<CppElementType>::actualCppType value);
+    void set(jobjectArray array, int index, typename JniArgumentType<CppElementType>::type value);
 
 private:
     const std::string className;
@@ -383,20 +639,19 @@ private:
 //#################################################################################################
 
 template <typename ReturnType, typename... Args>
-typename JniTypeMapping<ReturnType>::actualCppType StaticMethod<ReturnType, Args...>::invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs) {
+typename JniTypeMapping<ReturnType>::actualCppType StaticMethod<ReturnType, Args...>::invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs) {
     return HighLevelInvoker<ReturnType>::invoke(getMethodInfo()->class_, getMethodInfo()->methodID, javaArgs, refs);
 }
 
 template <typename ReturnType, typename... Args>
-typename JniTypeMapping<ReturnType>::actualCppType InstanceMethod<ReturnType, Args...>::invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs) {
-    jvalue jv = javaArgs.front();
-    jobject object = jv.l;
-    javaArgs.erase(javaArgs.begin(), javaArgs.begin() + 1);
-    return HighLevelInvoker<ReturnType>::invoke(object, getMethodInfo()->methodID, javaArgs, refs);
+typename JniTypeMapping<ReturnType>::actualCppType InstanceMethod<ReturnType, Args...>::invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs) {
+    // The target object is the first (reserved) argument, the rest are passed to the method
+    jobject object = javaArgs[0].l;
+    return HighLevelInvoker<ReturnType>::invoke(object, getMethodInfo()->methodID, javaArgs + 1, refs);
 }
 
 template <typename ReturnType, typename... Args>
-typename JniTypeMapping<ReturnType>::actualCppType SingletonMethod<ReturnType, Args...>::invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs) {
+typename JniTypeMapping<ReturnType>::actualCppType SingletonMethod<ReturnType, Args...>::invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs) {
     // Don't ever cache the singleton object.  It might change...
     jobject object = getSingletonObject(getClassName());
     if (!object) {
@@ -406,45 +661,97 @@ typename JniTypeMapping<ReturnType>::actualCppType SingletonMethod<ReturnType, A
 }
 
 template <typename ReturnType, typename... Args>
-jobject Constructor<ReturnType, Args...>::invoke(vector<jvalue>& javaArgs, JniLocalReferenceScope& refs) {
+jobject StaticMethod<ReturnType, Args...>::invokeForObject(const jvalue* javaArgs) {
+    jobject result = LowLevelInvoker<jobject>::invoke(getMethodInfo()->class_, getMethodInfo()->methodID, javaArgs);
+    checkForExceptions();
+    return result;
+}
+
+template <typename ReturnType, typename... Args>
+jobject InstanceMethod<ReturnType, Args...>::invokeForObject(const jvalue* javaArgs) {
+    jobject result = LowLevelInvoker<jobject>::invoke(javaArgs[0].l, getMethodInfo()->methodID, javaArgs + 1);
+    checkForExceptions();
+    return result;
+}
+
+template <typename ReturnType, typename... Args>
+jobject SingletonMethod<ReturnType, Args...>::invokeForObject(const jvalue* javaArgs) {
+    jobject object = getSingletonObject(getClassName());
+    if (!object) {
+        throw std::runtime_error(std::string("Singleton ") + getClassName() + " not currently available when referenced in SingletonMethod");
+    }
+    jobject result = LowLevelInvoker<jobject>::invoke(object, getMethodInfo()->methodID, javaArgs);
+    checkForExceptions();
+    return result;
+}
+
+template <typename ReturnType, typename... Args>
+jobject Constructor<ReturnType, Args...>::invoke(const jvalue* javaArgs, JniLocalReferenceScope& refs) {
     using actualReturnType = typename JniTypeMapping<ReturnType>::actualCppType;
-    return JvmObjectPassThrough<actualReturnType, IsGlobalRef<ReturnType>::value>::pass(env()->NewObjectA(getMethodInfo()->class_, getMethodInfo()->methodID, javaArgs.data()), refs);
+    return JvmObjectPassThrough<actualReturnType, IsGlobalRef<ReturnType>::value>::pass(env()->NewObjectA(getMethodInfo()->class_, getMethodInfo()->methodID, javaArgs), refs);
+}
+
+template <typename ReturnType, typename... Args>
+jobject Constructor<ReturnType, Args...>::invokeForObject(const jvalue* javaArgs) {
+    jobject result = env()->NewObjectA(getMethodInfo()->class_, getMethodInfo()->methodID, javaArgs);
+    checkForExceptions();
+    return result;
 }
 
 
 template <typename ReturnType, typename... Args>
-typename JniTypeMapping<ReturnType>::actualCppType Method<ReturnType, Args...>::operator ()(typename JniTypeMapping<Args>::actualCppType ...args) {
-    numParameters = sizeof...(args) - numReservedParameters;
-    vector<jvalue> javaArgs;
-    javaArgs.reserve(numParameters + numReservedParameters);
+typename JniTypeMapping<ReturnType>::actualCppType Method<ReturnType, Args...>::operator ()(typename JniArgumentType<Args>::type ...args) {
+    // Argument count is known at compile time so marshal into a stack buffer rather than the heap
+    std::array<jvalue, sizeof...(Args)> javaArgs;
 
     //
     // Use JniLocalReferenceScope to push a new JNI frame so that all local references will be cleaned up.  If ReturnType is jobject,
     // however, we need to pass in the returned java object to get a new reference in the old frame.  Pass refs into the
     // subclass invoke, which passes it to the HighLeverInvoker, which (if this isn't a void return Method) passes it into
     // the JvmObjectPassThrough which will, for a jobject, pop the frame early and pass the jobject return value to get a reference
-    // that will still be valid in the calling frame.
+    // that will still be valid in the calling frame.  If none of the types can create local references (all primitive, for
+    // example) no frame is pushed at all.
     //
+    JniLocalReferenceScope refs(numParameters + numReservedParameters + 1, NeedsLocalFrame<ReturnType, Args...>::value);
+    GatherArguments<Args...>::gather(javaArgs.data(), args...);
+    return invoke(javaArgs.data(), refs);
+}
+
+template <typename ReturnType, typename... Args>
+template <typename OutString>
+void Method<ReturnType, Args...>::call_into(OutString& out, typename JniArgumentType<Args>::type ...args) {
+    static_assert(JniSignature<ReturnType>::signature().view() == "Ljava/lang/String;", "call_into needs a method returning a String");
+    std::array<jvalue, sizeof...(Args)> javaArgs;
+    // The returned string is a local reference too, so there is always a frame
+    JniLocalReferenceScope refs(numParameters + numReservedParameters + 1);
+    GatherArguments<Args...>::gather(javaArgs.data(), args...);
+    jStringToString(static_cast<jstring>(invokeForObject(javaArgs.data())), out);
+}
+
+template <typename ReturnType, typename... Args>
+size_t Method<ReturnType, Args...>::call_into(char *buffer, size_t size, typename JniArgumentType<Args>::type ...args) {
+    static_assert(JniSignature<ReturnType>::signature().view() == "Ljava/lang/String;", "call_into needs a method returning a String");
+    std::array<jvalue, sizeof...(Args)> javaArgs;
     JniLocalReferenceScope refs(numParameters + numReservedParameters + 1);
-    GatherArguments<Args...>::gather(javaArgs, args...);
-    return invoke(javaArgs, refs);
+    GatherArguments<Args...>::gather(javaArgs.data(), args...);
+    return jStringToBuffer(static_cast<jstring>(invokeForObject(javaArgs.data())), buffer, size);
 }
 
 template <typename FieldType>
 typename JniTypeMapping<FieldType>::actualCppType InstanceField<FieldType>::get(jobject object) {
-    JniLocalReferenceScope refs;
+    JniLocalReferenceScope refs(kFieldFrameCapacity, NeedsLocalFrame<FieldType>::value);
     return HighLevelAccessor<FieldType>::get(object, getFieldInfo()->fieldID, refs);
 }
 
 template <typename FieldType>
-void InstanceField<FieldType>::set(jobject object, typename JniTypeMapping<FieldType>::actualCppType value) {
-    JniLocalReferenceScope refs;
+void InstanceField<FieldType>::set(jobject object, typename JniArgumentType<FieldType>::type value) {
+    JniLocalReferenceScope refs(kFieldFrameCapacity, NeedsLocalFrame<FieldType>::value);
     HighLevelAccessor<FieldType>::set(object, getFieldInfo()->fieldID, value);
 }
 
 template <typename FieldType>
 typename JniTypeMapping<FieldType>::actualCppType SingletonField<FieldType>::get() {
-    JniLocalReferenceScope refs;
+    JniLocalReferenceScope refs(kFieldFrameCapacity, NeedsLocalFrame<FieldType>::value);
     // Don't ever cache the singleton object.  It might change...
     jobject object = getSingletonObject(className);
     if (!object) throw new std::runtime_error(std::string("Singleton ") + className + " not available when referenced by SingletonField.");
@@ -452,8 +759,8 @@ typename JniTypeMapping<FieldType>::actualCppType SingletonField<FieldType>::get
 }
 
 template <typename FieldType>
-void SingletonField<FieldType>::set(typename JniTypeMapping<FieldType>::actualCppType value) {
-    JniLocalReferenceScope refs;
+void SingletonField<FieldType>::set(typename JniArgumentType<FieldType>::type value) {
+    JniLocalReferenceScope refs(kFieldFrameCapacity, NeedsLocalFrame<FieldType>::value);
     jobject object = getSingletonObject(className);
     if (!object) throw new std::runtime_error(std::string("Singleton ") + className + " not available when referenced by SingletonField.");
     HighLevelAccessor<FieldType>::set(object, getFieldInfo()->fieldID, value);
@@ -461,13 +768,13 @@ void SingletonField<FieldType>::set(typename JniTypeMapping<FieldType>::actualCp
 
 template <typename FieldType>
 typename JniTypeMapping<FieldType>::actualCppType StaticField<FieldType>::get() {
-    JniLocalReferenceScope refs;
+    JniLocalReferenceScope refs(kFieldFrameCapacity, NeedsLocalFrame<FieldType>::value);
     return HighLevelAccessor<FieldType>::get(getFieldInfo()->class_, getFieldInfo()->fieldID, refs);
 }
 
 template <typename FieldType>
-void StaticField<FieldType>::set(typename JniTypeMapping<FieldType>::actualCppType value) {
-    JniLocalReferenceScope refs;
+void StaticField<FieldType>::set(typename JniArgumentType<FieldType>::type value) {
+    JniLocalReferenceScope refs(kFieldFrameCapacity, NeedsLocalFrame<FieldType>::value);
     HighLevelAccessor<FieldType>::set(getFieldInfo()->class_, getFieldInfo()->fieldID, value);
 }
 
@@ -507,8 +814,9 @@ typename PrimitiveArray<CppElementType>::ArrayType PrimitiveArray<CppElementType
 
 template <typename CppElementType>
 void PrimitiveArray<CppElementType>::set(ArrayType javaArray, CppElementType cppArray[], int start, int size) {
-    JniLocalReferenceScope refs;
-    LowLevelAccessor<JavaType>::setElements(javaArray, cppArray, start, size);
+    // Region copies don't create local references so no frame is needed
+    static_assert(sizeof(CppElementType) == sizeof(JavaType), "Element type must be the same size as the Java type");
+    LowLevelAccessor<JavaType>::setElements(javaArray, reinterpret_cast<JavaType *>(cppArray), start, size);
 }
 
 template <typename CppElementType>
@@ -516,9 +824,71 @@ void PrimitiveArray<CppElementType>::set(ArrayType javaArray, CppElementType cpp
     set(javaArray, cppArray, 0, len);
 }
 
+template <typename CppElementType>
+void PrimitiveArray<CppElementType>::set(ArrayType javaArray, int start, std::span<const CppElementType> values) {
+    set(javaArray, const_cast<CppElementType *>(values.data()), start, int(values.size()));
+}
+
+template <typename CppElementType>
+void PrimitiveArray<CppElementType>::getRegion(ArrayType javaArray, int start, int len, CppElementType out[]) {
+    static_assert(sizeof(CppElementType) == sizeof(JavaType), "Element type must be the same size as the Java type");
+    LowLevelAccessor<JavaType>::getElementsRegion(javaArray, start, len, reinterpret_cast<JavaType *>(out));
+    checkForExceptions();
+}
+
+template <typename CppElementType>
+void PrimitiveArray<CppElementType>::getRegion(ArrayType javaArray, int start, std::span<CppElementType> out) {
+    getRegion(javaArray, start, int(out.size()), out.data());
+}
+
+template <typename CppElementType>
+std::vector<CppElementType> PrimitiveArray<CppElementType>::toVector(ArrayType javaArray) {
+    return toVector(javaArray, 0, size(javaArray));
+}
+
+template <typename CppElementType>
+std::vector<CppElementType> PrimitiveArray<CppElementType>::toVector(ArrayType javaArray, int start, int len) {
+    if constexpr (std::is_same_v<CppElementType, bool>) {
+        // std::vector<bool> is packed, go through jbooleans
+        std::vector<jboolean> elements(len);
+        LowLevelAccessor<jboolean>::getElementsRegion(javaArray, start, len, elements.data());
+        checkForExceptions();
+        return std::vector<bool>(elements.begin(), elements.end());
+    } else {
+        std::vector<CppElementType> elements(len);
+        getRegion(javaArray, start, len, elements.data());
+        return elements;
+    }
+}
+
+template <typename CppElementType>
+bool PrimitiveArray<CppElementType>::getRegionChunked(ArrayType javaArray, int start, std::span<CppElementType> out, const ArrayTransferOptions& options) {
+    static_assert(sizeof(CppElementType) == sizeof(JavaType), "Element type must be the same size as the Java type");
+    if (start < 0 || size_t(start) + out.size() > size_t(size(javaArray))) {
+        throw std::runtime_error("getRegionChunked range is out of bounds");
+    }
+    // Local references belong to the calling thread, the workers copy through a global one
+    JniScopedGlobalReference<ArrayType> array(javaArray);
+    return runChunkedTransfer(out.size(), options, [&](size_t offset, size_t count) {
+        LowLevelAccessor<JavaType>::getElementsRegion(*array, start + int(offset), int(count), reinterpret_cast<JavaType *>(out.data() + offset));
+    });
+}
+
+template <typename CppElementType>
+bool PrimitiveArray<CppElementType>::setRegionChunked(ArrayType javaArray, int start, std::span<const CppElementType> values, const ArrayTransferOptions& options) {
+    static_assert(sizeof(CppElementType) == sizeof(JavaType), "Element type must be the same size as the Java type");
+    if (start < 0 || size_t(start) + values.size() > size_t(size(javaArray))) {
+        throw std::runtime_error("setRegionChunked range is out of bounds");
+    }
+    JniScopedGlobalReference<ArrayType> array(javaArray);
+    return runChunkedTransfer(values.size(), options, [&](size_t offset, size_t count) {
+        auto *elements = const_cast<CppElementType *>(values.data() + offset);
+        LowLevelAccessor<JavaType>::setElements(*array, reinterpret_cast<JavaType *>(elements), start + int(offset), int(count));
+    });
+}
+
 template <typename CppElementType>
 CppElementType* PrimitiveArray<CppElementType>::get(ArrayType array, bool* isCopy) {
-    JniLocalReferenceScope refs;
     jboolean jniIsCopy;
     CppElementType* arrayPointer = (CppElementType*) LowLevelAccessor<JavaType>::getElements(array, &jniIsCopy);
     if (isCopy) {
@@ -528,8 +898,8 @@ CppElementType* PrimitiveArray<CppElementType>::get(ArrayType array, bool* isCop
 }
 
 template <typename CppElementType>
-void PrimitiveArray<CppElementType>::release(ArrayType array, CppElementType* arrayPointer) {
-    LowLevelAccessor<JavaType>::releaseElements(array, arrayPointer);
+void PrimitiveArray<CppElementType>::release(ArrayType array, CppElementType* arrayPointer, jint mode) {
+    LowLevelAccessor<JavaType>::releaseElements(array, reinterpret_cast<JavaType *>(arrayPointer), mode);
 }
 
 template <typename CppElementType>
@@ -543,8 +913,78 @@ CppElementType* PrimitiveArray<CppElementType>::getCritical(ArrayType array, boo
 }
 
 template <typename CppElementType>
-void PrimitiveArray<CppElementType>::releaseCritical(ArrayType array, CppElementType* arrayPointer) {
-    env()->ReleasePrimitiveArrayCritical(array, arrayPointer, 0);
+void PrimitiveArray<CppElementType>::releaseCritical(ArrayType array, CppElementType* arrayPointer, jint mode) {
+    env()->ReleasePrimitiveArrayCritical(array, arrayPointer, mode);
+}
+
+template <typename CppElementType, ArrayAccess access>
+ArrayElements<CppElementType, access>::ArrayElements(ArrayType array) : array(array), elements(nullptr), length(0) {
+    if (array) {
+        length = size_t(PrimitiveArray<CppElementType>::size(array));
+        elements = PrimitiveArray<CppElementType>::get(array, &copy);
+        if (!elements) {
+            throw std::runtime_error("Out of memory getting array elements");
+        }
+    }
+}
+
+template <typename CppElementType, ArrayAccess access>
+ArrayElements<CppElementType, access>::ArrayElements(ArrayElements&& other) noexcept :
+        array(other.array), elements(other.elements), length(other.length), copy(other.copy) {
+    other.elements = nullptr;
+    other.length = 0;
+}
+
+template <typename CppElementType, ArrayAccess access>
+void ArrayElements<CppElementType, access>::commit() {
+    static_assert(access == ARRAY_READ_WRITE, "Only read write elements can be committed");
+    if (elements && copy) {
+        PrimitiveArray<CppElementType>::release(array, elements, JNI_COMMIT);
+    }
+}
+
+template <typename CppElementType, ArrayAccess access>
+void ArrayElements<CppElementType, access>::release() {
+    if (elements) {
+        PrimitiveArray<CppElementType>::release(array, const_cast<CppElementType*>(elements), access == ARRAY_READ_ONLY ? JNI_ABORT : 0);
+        elements = nullptr;
+        length = 0;
+    }
+}
+
+template <typename CppElementType, ArrayAccess access>
+CriticalArray<CppElementType, access>::CriticalArray(ArrayType array) : array(array), elements(nullptr), length(0) {
+    if (array) {
+        length = size_t(PrimitiveArray<CppElementType>::size(array));
+        elements = PrimitiveArray<CppElementType>::getCritical(array, &copy);
+        if (!elements) {
+            throw std::runtime_error("Out of memory getting critical array elements");
+        }
+    }
+}
+
+template <typename CppElementType, ArrayAccess access>
+CriticalArray<CppElementType, access>::CriticalArray(CriticalArray&& other) noexcept :
+        array(other.array), elements(other.elements), length(other.length), copy(other.copy) {
+    other.elements = nullptr;
+    other.length = 0;
+}
+
+template <typename CppElementType, ArrayAccess access>
+void CriticalArray<CppElementType, access>::commit() {
+    static_assert(access == ARRAY_READ_WRITE, "Only read write elements can be committed");
+    if (elements && copy) {
+        PrimitiveArray<CppElementType>::releaseCritical(array, elements, JNI_COMMIT);
+    }
+}
+
+template <typename CppElementType, ArrayAccess access>
+void CriticalArray<CppElementType, access>::release() {
+    if (elements) {
+        PrimitiveArray<CppElementType>::releaseCritical(array, const_cast<CppElementType*>(elements), access == ARRAY_READ_ONLY ? JNI_ABORT : 0);
+        elements = nullptr;
+        length = 0;
+    }
 }
 
 template <typename CppElementType>
@@ -558,15 +998,134 @@ typename JniTypeMapping<CppElementType>::actualCppType ObjectArray<CppElementTyp
     JniLocalReferenceScope refs;
     jobject javaReturn =  env()->GetObjectArrayElement(array, index);
     actualReturnType value = ToCppConverter<actualReturnType>::convertToCpp(javaReturn);
-    return JvmObjectPassThrough<actualReturnType, IsGlobalRef<CppElementType>::value>::pass(value, refs);
+    return JvmObjectPassThrough<actualReturnType, IsGlobalRef<CppElementType>::value>::pass(std::move(value), refs);
 }
 
 template <typename CppElementType>
-void ObjectArray<CppElementType>::set(jobjectArray array, int index, typename JniTypeMapping<CppElementType>::actualCppType  value) {
+void ObjectArray<CppElementType>::set(jobjectArray array, int index, typename JniArgumentType<CppElementType>::type value) {
     JniLocalReferenceScope refs;
-    jobject javaValue = convertToJValue(value);
+    jobject javaValue = ToJavaConverter<CppElementType>::convertToJava(value);
     env()->SetObjectArrayElement(array, index, javaValue);
 }
 
+template <PrimitiveArrayElement CppElementType>
+struct PrimitiveArraySignature {
+    static constexpr auto signature() {
+        return concatFixedStrings(FixedString("["), JniSignature<CppElementType>::signature());
+    }
+    static constexpr auto typeName() {
+        return concatFixedStrings(JniSignature<CppElementType>::typeName(), FixedString("[]"));
+    }
+};
+
+// The std::vector, std::span and std::array conversions, each a single region copy
+template <PrimitiveArrayElement CppElementType>
+struct PrimitiveArrayConversion {
+    using JavaType = typename JniTypeMapping<CppElementType>::jniType;
+    using ArrayType = typename PrimitiveArray<CppElementType>::ArrayType;
+
+    static jobject toJava(std::span<const CppElementType> values) {
+        ArrayType array = LowLevelAccessor<JavaType>::createJavaArray(int(values.size()));
+        if (!array) {
+            checkForExceptions();
+            throw std::runtime_error("Out of memory creating Java array");
+        }
+        PrimitiveArray<CppElementType>::set(array, 0, values);
+        return array;
+    }
+
+    static std::vector<CppElementType> toVector(jobject val) {
+        if (!val) {
+            return {};
+        }
+        std::vector<CppElementType> result = PrimitiveArray<CppElementType>::toVector(static_cast<ArrayType>(val));
+        env()->DeleteLocalRef(val);
+        return result;
+    }
+
+    template <size_t N>
+    static std::array<CppElementType, N> toArray(jobject val) {
+        auto array = static_cast<ArrayType>(val);
+        size_t length = val ? size_t(PrimitiveArray<CppElementType>::size(array)) : 0;
+        if (length != N) {
+            env()->DeleteLocalRef(val);
+            throw std::runtime_error("Java array of length " + std::to_string(length) + " can't be converted to std::array of size " + std::to_string(N));
+        }
+        std::array<CppElementType, N> result{};
+        if (val) {
+            PrimitiveArray<CppElementType>::getRegion(array, 0, std::span<CppElementType>(result));
+            env()->DeleteLocalRef(val);
+        }
+        return result;
+    }
+};
+
+template <PrimitiveArrayElement CppElementType>
+struct JniTypeMapping<std::vector<CppElementType>> {
+    using actualCppType = std::vector<CppElementType>;
+    using jniType = jobject;
+};
+template <PrimitiveArrayElement CppElementType>
+struct JniSignature<std::vector<CppElementType>> : PrimitiveArraySignature<CppElementType> {};
+template <PrimitiveArrayElement CppElementType>
+struct ToCppConverter<std::vector<CppElementType>> {
+    static std::vector<CppElementType> convertToCpp(jobject val) {
+        return PrimitiveArrayConversion<CppElementType>::toVector(val);
+    }
+};
+template <PrimitiveArrayElement CppElementType>
+struct ToJavaConverter<std::vector<CppElementType>> {
+    static jobject convertToJava(const std::vector<CppElementType>& value) {
+        if constexpr (std::is_same_v<CppElementType, bool>) {
+            // std::vector<bool> is packed and has no data(), go through a temporary of bools
+            std::unique_ptr<bool[]> elements(new bool[value.size()]);
+            std::copy(value.begin(), value.end(), elements.get());
+            return PrimitiveArrayConversion<bool>::toJava(std::span<const bool>(elements.get(), value.size()));
+        } else {
+            return PrimitiveArrayConversion<CppElementType>::toJava(value);
+        }
+    }
+};
+
+template <PrimitiveArrayElement CppElementType>
+struct JniTypeMapping<std::span<const CppElementType>> {
+    using actualCppType = std::span<const CppElementType>;
+    using jniType = jobject;
+};
+template <PrimitiveArrayElement CppElementType>
+struct JniSignature<std::span<const CppElementType>> : PrimitiveArraySignature<CppElementType> {};
+template <PrimitiveArrayElement CppElementType>
+struct ToJavaConverter<std::span<const CppElementType>> {
+    static jobject convertToJava(std::span<const CppElementType> value) {
+        return PrimitiveArrayConversion<CppElementType>::toJava(value);
+    }
+};
+
+template <PrimitiveArrayElement CppElementType, size_t N>
+struct JniTypeMapping<std::array<CppElementType, N>> {
+    using actualCppType = std::array<CppElementType, N>;
+    using jniType = jobject;
+};
+// Trivially copyable, but can be big, so passed by reference
+template <PrimitiveArrayElement CppElementType, size_t N>
+struct JniArgumentType<std::array<CppElementType, N>> {
+    using actualCppType = std::array<CppElementType, N>;
+    using type = const actualCppType&;
+};
+template <PrimitiveArrayElement CppElementType, size_t N>
+struct JniSignature<std::array<CppElementType, N>> : PrimitiveArraySignature<CppElementType> {};
+template <PrimitiveArrayElement CppElementType, size_t N>
+struct ToCppConverter<std::array<CppElementType, N>> {
+    static std::array<CppElementType, N> convertToCpp(jobject val) {
+        return PrimitiveArrayConversion<CppElementType>::template toArray<N>(val);
+    }
+};
+template <PrimitiveArrayElement CppElementType, size_t N>
+struct ToJavaConverter<std::array<CppElementType, N>> {
+    static jobject convertToJava(const std::array<CppElementType, N>& value) {
+        return PrimitiveArrayConversion<CppElementType>::toJava(value);
+    }
+};
+
 } // namespace jni_pp
 
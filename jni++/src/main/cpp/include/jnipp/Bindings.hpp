@@ -0,0 +1,85 @@
+//
+// Bindings.hpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace jni_pp {
+
+struct MemberRequest;
+
+//
+// Base class of everything that lazily resolves something in the JVM on first use (StaticMethod, InstanceMethod,
+// SingletonMethod, Constructor, the Field types and ObjectArray).  Each of those registers itself when constructed
+// and unregisters when destroyed so that warmup() can resolve all of them up front.
+//
+// Registration is done by the concrete classes, not here, so that warmup never sees a partially constructed (or
+// partially destroyed) binding.
+//
+class Binding {
+public:
+    Binding() = default;
+    Binding(const Binding&) = delete;
+    Binding& operator=(const Binding&) = delete;
+    virtual ~Binding() = default;
+
+    /// @brief Resolve (and cache) whatever this binding would otherwise look up on first use.
+    virtual void resolve() = 0;
+
+    /// @brief Describe the member this binding resolves, so warmup can resolve many of them together.
+    /// @param request Filled in with the member to look up (see resolveMembers)
+    /// @return false if the binding doesn't resolve a single member (the default)
+    virtual bool describeMember(MemberRequest& request) {
+        return false;
+    }
+};
+
+void registerBinding(Binding *binding);
+
+// Blocks if the binding is being resolved by warmup on another thread.
+void unregisterBinding(Binding *binding);
+
+size_t registeredBindingCount();
+
+typedef enum WarmupMode {
+    WARMUP_NONE,        // Bindings resolve lazily on first use (default)
+    WARMUP_IMMEDIATE,   // warmup() runs on the loading thread from JNI_OnLoad/createVM
+    WARMUP_BACKGROUND   // warmupInBackground() is started from JNI_OnLoad/createVM
+} WarmupMode;
+
+//
+// Set what happens once the environment is initialized (JNI_OnLoad or createVM).  Like setCurrentVersion this has to be
+// set before the library is loaded, probably from a static context.  Also set the package base and swig package
+// before then, since class names are resolved at warmup.
+//
+void setWarmupMode(WarmupMode mode);
+WarmupMode getWarmupMode();
+
+//
+// Resolve every registered binding on the calling thread.  Members described by the bindings are resolved together
+// first (see resolveMembers) so their reflective lookups take a single call into Java.  Bindings that fail to resolve
+// are logged and left unresolved, to be looked up again (and throw resolution_error if they still fail) on first use.
+// Returns the number of bindings resolved.
+//
+size_t warmup();
+
+//
+// Run warmup() on a new thread attached to the JVM.  The thread is a plain attached native thread, so FindClass uses
+// the system class loader.  On Android, where application classes are only visible to the app class loader, call
+// warmup() from a thread that has it instead (e.g. from Java or using WARMUP_IMMEDIATE).
+//
+void warmupInBackground();
+
+// Wait for a background warmup, if one is running.  Called by destroyVM.
+void waitForWarmup();
+
+} // namespace jni_pp
@@ -0,0 +1,186 @@
+//
+// Buffers.hpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#pragma once
+
+#include <jni.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "jnipp/Converters.hpp"
+
+namespace jni_pp {
+
+//
+// Native memory shared with Java as a direct java.nio.ByteBuffer, so bulk binary data crosses the boundary without
+// being copied.  Usable as an argument, return and field type.
+//
+// Passed to Java, a DirectBuffer becomes a new ByteBuffer over the same memory (NewDirectByteBuffer).  The memory
+// must stay valid for as long as Java uses the buffer.  Returned from Java, it refers to the memory of a direct
+// ByteBuffer (GetDirectBufferAddress), which is only valid while Java keeps that buffer reachable.  A null buffer is
+// an empty DirectBuffer, a heap (non direct) buffer throws.
+//
+//     std::vector<float> samples = ...;
+//     static StaticMethod<void, DirectBuffer> jProcess("com.example.Audio", "process");
+//     jProcess(DirectBuffer(std::span<float>(samples)));
+//
+// Java sees the bytes in ByteBuffer's default big endian order, use order(ByteOrder.nativeOrder()) on the Java side
+// for typed data.
+//
+class DirectBuffer {
+public:
+    DirectBuffer() = default;
+    DirectBuffer(void *data, size_t size) : address(static_cast<std::byte *>(data)), length(size) {}
+
+    template <typename T>
+    explicit DirectBuffer(std::span<T> elements) :
+            address(reinterpret_cast<std::byte *>(const_cast<std::remove_const_t<T> *>(elements.data()))),
+            length(elements.size_bytes()) {}
+
+    std::byte *data() const { return address; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    std::span<std::byte> bytes() const {
+        return std::span<std::byte>(address, length);
+    }
+
+    // The memory as elements of T.  Any bytes left over at the end are not included.
+    template <typename T>
+    std::span<T> as() const {
+        return std::span<T>(reinterpret_cast<T *>(address), length / sizeof(T));
+    }
+
+private:
+    std::byte *address = nullptr;
+    size_t length = 0;
+};
+
+// New direct ByteBuffer (local reference) over buffer's memory, null for an empty DirectBuffer
+jobject toJavaByteBuffer(const DirectBuffer& buffer);
+
+// The memory of a direct ByteBuffer.  Throws std::runtime_error if byteBuffer isn't direct.
+DirectBuffer fromJavaByteBuffer(jobject byteBuffer);
+
+//
+// A pool of fixed size blocks of native memory, lent to Java as direct ByteBuffers.  For handing Java many short
+// lived views of native data (decoded frames, packets) without an allocateDirect or malloc for each one.
+//
+// Blocks are carved out of slabs of blocksPerSlab blocks, allocated as the pool grows and kept until the pool is
+// destroyed, so once a pool has grown to its working set lending and releasing allocate nothing.
+//
+//     static DirectBufferPool framePool(1920 * 1080 * 4);
+//     jobject frame = framePool.lend();
+//     decodeInto(fromJavaByteBuffer(frame).data());
+//     jOnFrame(frame);   // Java calls JavaToNativeExporter.releasePooledBuffer(frame) when done with it
+//
+// A block is returned with release(), from native code, or JavaToNativeExporter.releasePooledBuffer(), from Java.
+// Blocks lent with lendTracked() are also returned when Java garbage collects the buffer.  Memory must not be used
+// after its block is released.  All blocks must be released before the pool is destroyed.
+//
+// An explicit release, from either side, must be made exactly once per lend or acquire.  It can't tell one lend of
+// a block from the next (lend() even reuses the ByteBuffer object), so a duplicate or late release frees the block
+// from under whoever it has been lent to since.  Only the release when Java collects a lendTracked() buffer checks
+// which lend it came from, so that one is harmless after an explicit release.
+//
+typedef struct BufferPoolStats {
+    size_t capacity;    // Blocks in all slabs
+    size_t inUse;       // Blocks lent or acquired now
+    size_t peakInUse;   // Most blocks in use at once
+    size_t slabs;       // Slabs allocated
+} BufferPoolStats;
+
+class DirectBufferPool {
+public:
+    // maxSlabs of 0 lets the pool grow without limit
+    explicit DirectBufferPool(size_t blockSize, size_t blocksPerSlab = 16, size_t maxSlabs = 0);
+    ~DirectBufferPool();
+
+    DirectBufferPool(const DirectBufferPool&) = delete;
+    DirectBufferPool& operator=(const DirectBufferPool&) = delete;
+
+    // A block for native use.  Throws std::runtime_error if the pool is at maxSlabs and every block is in use.
+    DirectBuffer acquire();
+
+    // A block as a direct ByteBuffer (local reference).  The ByteBuffer object of each block is kept and lent again,
+    // cleared (position 0, limit at capacity) but with whatever byte order Java last set.
+    jobject lend();
+
+    // A block as a new direct ByteBuffer (local reference), which is also released when Java garbage collects it.
+    // For buffers whose lifetime native code doesn't know.  Costs a ByteBuffer and a PhantomReference per call.
+    jobject lendTracked();
+
+    void release(const DirectBuffer& block);
+    void release(jobject byteBuffer);
+
+    size_t blockSize() const { return blockBytes; }
+    BufferPoolStats stats() const;
+
+private:
+    struct Block;
+    struct Slab;
+
+    Block *acquireBlock();
+    void addSlab();
+
+    // Slabs of all pools by their first byte, for finding the block containing an address
+    static std::map<const std::byte *, Slab *>& slabsByAddress();
+
+    size_t blockBytes;
+    size_t blockStride;
+    size_t blocksPerSlab;
+    size_t maxSlabs;
+    std::vector<std::unique_ptr<Slab>> slabs;
+    std::vector<Block *> freeBlocks;
+    size_t inUse = 0;
+    size_t peakInUse = 0;
+
+    friend bool releasePooledBlock(const void *address, uint64_t generation);
+};
+
+// Return the block of any pool starting at address.  An address inside a block (of a slice, for example) releases
+// nothing.  A non zero generation must match the lend it came from, so a late release of a block that was since lent
+// again is ignored.  Returns false if nothing was released.
+bool releasePooledBlock(const void *address, uint64_t generation = 0);
+
+
+//#################################################################################################
+//#################################################################################################
+//########
+//########                  Implementation details
+//########
+//#################################################################################################
+//#################################################################################################
+
+
+template<> struct JniTypeMapping<DirectBuffer> {
+    using actualCppType = DirectBuffer;
+    using jniType = jobject;
+};
+template<> struct JniSignature<DirectBuffer> : FixedJniSignature<"Ljava/nio/ByteBuffer;", "java.nio.ByteBuffer"> {};
+template<> struct ToCppConverter<DirectBuffer> {
+    static DirectBuffer convertToCpp(jobject val) {
+        DirectBuffer result = fromJavaByteBuffer(val);
+        env()->DeleteLocalRef(val);
+        return result;
+    }
+};
+template<> struct ToJavaConverter<DirectBuffer> {
+    static jobject convertToJava(DirectBuffer value) {
+        return toJavaByteBuffer(value);
+    }
+};
+
+} // namespace jni_pp
@@ -0,0 +1,163 @@
+//
+// ConcurrentCache.hpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace jni_pp {
+
+//
+// FNV-1a.  Lets a key be hashed one piece at a time so lookups never have to concatenate strings.
+//
+class KeyHasher {
+public:
+    KeyHasher& add(std::string_view piece) {
+        for (char c : piece) {
+            mix(static_cast<unsigned char>(c));
+        }
+        mix(0xFF);  // Separator so ("ab", "c") and ("a", "bc") hash differently
+        return *this;
+    }
+
+    KeyHasher& add(int64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            mix(static_cast<unsigned char>(value >> (i * 8)));
+        }
+        return *this;
+    }
+
+    size_t value() const { return static_cast<size_t>(hash); }
+
+private:
+    void mix(unsigned char byte) {
+        hash ^= byte;
+        hash *= 1099511628211ULL;
+    }
+
+    uint64_t hash = 14695981039346656037ULL;
+};
+
+//
+// Read-mostly concurrent hash map.  Entries are spread over NumShards independent maps, each with its own
+// shared_mutex, so lookups from many threads only take shared locks and writers only block their own shard.
+//
+// Key (and any lookup key type) must provide hash() returning a precomputed hash, and be comparable with ==.  Lookups
+// can use a different, cheaper key type (e.g. one made of string_views) as long as it hashes and compares the same.
+//
+template <typename Key, typename Value, size_t NumShards = 16>
+class ConcurrentCache {
+public:
+    template <typename LookupKey>
+    std::optional<Value> find(const LookupKey& key) const {
+        const Shard& shard = shardFor(key.hash());
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    //
+    // Return the value for key, calling makeValue() to create it if there isn't one yet.  makeValue is called with the
+    // shard locked so it should be cheap; do any expensive work before calling this.
+    //
+    template <typename LookupKey, typename Factory>
+    Value findOrInsert(const LookupKey& key, Factory&& makeValue) {
+        Shard& shard = shardFor(key.hash());
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it != shard.map.end()) {
+            return it->second;
+        }
+        return shard.map.emplace(Key(key), makeValue()).first->second;
+    }
+
+    //
+    // Like findOrInsert but keeps each shard to at most maxShardEntries.  A full shard is emptied before inserting,
+    // which is crude but cheap, and entries that are still in use just get added back.
+    //
+    template <typename LookupKey, typename Factory>
+    Value findOrInsertBounded(const LookupKey& key, Factory&& makeValue, size_t maxShardEntries) {
+        Shard& shard = shardFor(key.hash());
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it != shard.map.end()) {
+            return it->second;
+        }
+        if (shard.map.size() >= maxShardEntries) {
+            shard.map.clear();
+        }
+        return shard.map.emplace(Key(key), makeValue()).first->second;
+    }
+
+    void clear() {
+        for (Shard& shard : shards) {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+    size_t size() const {
+        size_t total = 0;
+        for (const Shard& shard : shards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            total += shard.map.size();
+        }
+        return total;
+    }
+
+    static constexpr size_t numShards() {
+        return NumShards;
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (const Shard& shard : shards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& [key, value] : shard.map) {
+                fn(key, value);
+            }
+        }
+    }
+
+private:
+    struct KeyHash {
+        using is_transparent = void;
+        template <typename K>
+        size_t operator()(const K& key) const { return key.hash(); }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const { return a == b; }
+    };
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Key, Value, KeyHash, KeyEqual> map;
+    };
+
+    const Shard& shardFor(size_t hash) const { return shards[(hash >> 7) % NumShards]; }
+    Shard& shardFor(size_t hash) { return shards[(hash >> 7) % NumShards]; }
+
+    std::array<Shard, NumShards> shards;
+};
+
+} // namespace jni_pp
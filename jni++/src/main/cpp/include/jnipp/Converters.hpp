@@ -15,8 +15,11 @@
 #include <jni.h>
 #include <typeindex>
 #include <map>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <string.h>
+#include <type_traits>
 
 #include "jnipp/Utilities.hpp"
 #include "jnipp/References.hpp"
@@ -39,10 +42,21 @@ struct IsGlobalRef<jglobal> {
     static constexpr bool value = true;
 };
 
+//
+// JNI signature and JVM type name for a C++ type.  Both are compile time constants (FixedString) so that method
+// signatures can be assembled at compile time by JniMethodSignature.
+//
 template<typename CppType>
 struct JniSignature {
-    std::string signature() { return "unknown"; }
-    std::string typeName() { return "unknown"; }
+    static constexpr auto signature() { return FixedString("unknown"); }
+    static constexpr auto typeName() { return FixedString("unknown"); }
+};
+
+// Convenience base for JniSignature specializations of types with a fixed signature
+template<FixedString jniSignature, FixedString jvmTypeName>
+struct FixedJniSignature {
+    static constexpr auto signature() { return jniSignature; }
+    static constexpr auto typeName() { return jvmTypeName; }
 };
 
 template <typename DeclaredCppType>
@@ -55,6 +69,43 @@ template<> struct JniTypeMapping<jglobal> {
     using jniType = jobject;
 };
 
+//
+// How a value of the type is passed into the conversion chain (Method::operator(), GatherArguments, ToJavaConverter,
+// field setters).  Anything that is expensive to copy, such as std::string, is passed by const reference so that an
+// argument is only ever copied when it is converted to Java.  Scalars, pointers and small trivially copyable types
+// such as std::string_view are passed by value.
+//
+template<typename DeclaredCppType>
+struct JniArgumentType {
+    using actualCppType = typename JniTypeMapping<DeclaredCppType>::actualCppType;
+    using type = std::conditional_t<std::is_class_v<actualCppType> && !std::is_trivially_copyable_v<actualCppType>,
+                                    const actualCppType&, actualCppType>;
+};
+
+//
+// Does converting a value of this type to or from Java create local references?  Primitives don't, and neither do raw
+// jobject style types since they are passed through unchanged.  Types that are converted (strings, boxed values,
+// mappings, ...) conservatively do.
+//
+template<typename CppType>
+struct CreatesLocalReferences {
+    using jniType = typename JniTypeMapping<CppType>::jniType;
+    static constexpr bool value = !std::is_arithmetic<jniType>::value && !std::is_void<jniType>::value;
+};
+template<> struct CreatesLocalReferences<jobject> { static constexpr bool value = false; };
+template<> struct CreatesLocalReferences<jglobal> { static constexpr bool value = false; };
+template<> struct CreatesLocalReferences<jarray> { static constexpr bool value = false; };
+template<> struct CreatesLocalReferences<jobjectArray> { static constexpr bool value = false; };
+
+//
+// A JNI local frame is only needed around a call if at least one of its argument or return types creates local
+// references.  For everything else (e.g. StaticMethod<int, int>) the PushLocalFrame/PopLocalFrame round trip is skipped.
+//
+template<typename... Types>
+struct NeedsLocalFrame {
+    static constexpr bool value = (CreatesLocalReferences<Types>::value || ...);
+};
+
 template<typename JavaType>
 struct JavaToArray {
     typedef jarray type;
@@ -73,7 +124,7 @@ template <typename DeclaredCppType>
 struct ToJavaConverter {
     using cppType = typename JniTypeMapping<DeclaredCppType>::actualCppType;
     using  jniType = typename JniTypeMapping<DeclaredCppType>::jniType;
-    static jniType convertToJava(cppType value) {
+    static jniType convertToJava(typename JniArgumentType<DeclaredCppType>::type value) {
         return jniType(value);
     }
 };
@@ -102,109 +153,102 @@ jvalue convertToJValue(double arg);
 jvalue convertToJValue(int64_t arg);
 jvalue convertToJValue(jobject arg);
 
+//
+// Strings are converted between standard UTF-8 and Java's UTF-16 by jni++ itself (see Utf.hpp) rather than with the
+// JNI modified UTF-8 functions.  Short strings are converted through a stack buffer, long ones directly from (or to)
+// the string contents so either way there is only one copy.
+//
 jstring toJString(const char *s);
 jstring toJString(const std::string& s);
+jstring toJString(const char *s, size_t length);
+jstring toJString(std::string_view s);
+jstring toJString(std::u16string_view s);
 
-inline std::string jStringToString(jstring s) {
-    if (s == nullptr) return "";
-	const char *c = env()->GetStringUTFChars(s, nullptr);
-	std::string result(c);
-	env()->ReleaseStringUTFChars(s, c);
-	return result;
-}
+std::string jStringToString(jstring s);
+char * jStringToCharPtr(jstring s);
+
+//
+// Convert into a caller provided string, reusing its capacity, so a loop converting many strings doesn't allocate
+// once out is big enough.  A null s leaves out empty.
+//
+void jStringToString(jstring s, std::string& out);
+void jStringToString(jstring s, std::pmr::string& out);
 
+//
+// Convert into buffer as a NUL terminated string, if it fits in size bytes (including the NUL).  Otherwise buffer is
+// left empty.  Returns the length of the UTF-8 conversion either way, like snprintf.
+//
+size_t jStringToBuffer(jstring s, char *buffer, size_t size);
 
-inline char * jStringToCharPtr(jstring s) {
-    if (s == nullptr) return nullptr;
-	const char *c = env()->GetStringUTFChars(s, nullptr);
-	char *r = strdup(c);
-	env()->ReleaseStringUTFChars(s, c);
-	return r;
-}
 
+//
+// Convert each argument and write it to consecutive slots of javaArgs, which must have room for sizeof...(Args) values.
+//
 template <typename... Args>
 struct GatherArguments;
 
 template <typename ArgType, typename... Args>
 struct GatherArguments<ArgType, Args...> {
-    static void gather(vector<jvalue> &javaArgs, typename JniTypeMapping<ArgType>::actualCppType arg1, typename JniTypeMapping<Args>::actualCppType ...remainingArgs) {
-        jvalue jarg1 = convertToJValue(ToJavaConverter<ArgType>::convertToJava(arg1));
-        javaArgs.push_back(jarg1);
-        GatherArguments<Args...>::gather(javaArgs, remainingArgs...);
+    static void gather(jvalue *javaArgs, typename JniArgumentType<ArgType>::type arg1, typename JniArgumentType<Args>::type ...remainingArgs) {
+        *javaArgs = convertToJValue(ToJavaConverter<ArgType>::convertToJava(arg1));
+        GatherArguments<Args...>::gather(javaArgs + 1, remainingArgs...);
     }
 };
 
 template <>
 struct GatherArguments<> {
-    static void gather(vector<jvalue> &javaArgs) {
+    static void gather(jvalue *javaArgs) {
     }
 };
 
-template <typename... Args>
-struct GatherSignature;
-
-template <typename ArgType, typename... Args>
-struct GatherSignature<ArgType, Args...> {
-    static void gather(std::stringstream& signatureBuffer, std::vector<std::string>& argumentTypes, int skipNum) {
-        if (skipNum <= 0) {
-            JniSignature<ArgType> signer;
-            signatureBuffer << signer.signature();
-            argumentTypes.push_back(signer.typeName());
-        }
-        GatherSignature<Args...>::gather(signatureBuffer, argumentTypes, skipNum - 1);
-    }
-};
-
-template <>
-struct GatherSignature<> {
-    static void gather(std::stringstream& signatureBuffer, std::vector<std::string>& argumentTypes, int skipNum) {
-    }
+//
+// The full JNI method signature, "(<argument signatures>)<return signature>", built at compile time and kept in
+// static storage.
+//
+template <typename ReturnType, typename... Args>
+struct JniMethodSignature {
+    static constexpr auto value = concatFixedStrings(FixedString("("), JniSignature<Args>::signature()..., FixedString(")"),
+                                                     JniSignature<ReturnType>::signature());
 };
 
-template<> inline std::string JniSignature<void>::signature() { return "V"; }
-template<> inline std::string JniSignature<short>::signature() { return "S"; }
-template<> inline std::string JniSignature<int>::signature() { return "I"; }
-template<> inline std::string JniSignature<long>::signature() { return "J"; }
-
-template<> inline std::string JniSignature<unsigned char>::signature() { return "B"; }
-template<> inline std::string JniSignature<char>::signature() { return "C"; }
-
-template<> inline std::string JniSignature<float>::signature() { return "F"; }
-template<> inline std::string JniSignature<double>::signature() { return "D"; }
-
-template<> inline std::string JniSignature<bool>::signature() { return "Z"; }
-
-template<> inline std::string JniSignature<char *>::signature() { return "Ljava/lang/String;"; }
-template<> inline std::string JniSignature<const char *>::signature() { return "Ljava/lang/String;"; }
-template<> inline std::string JniSignature<std::string>::signature() { return "Ljava/lang/String;"; }
-template<> inline std::string JniSignature<const std::string&>::signature() { return "Ljava/lang/String;"; }
+template<> struct JniSignature<void> : FixedJniSignature<"V", "void"> {};
+template<> struct JniSignature<short> : FixedJniSignature<"S", "short"> {};
+template<> struct JniSignature<int> : FixedJniSignature<"I", "int"> {};
+template<> struct JniSignature<long> : FixedJniSignature<"J", "long"> {};
+template<> struct JniSignature<long long> : FixedJniSignature<"J", "long"> {};
 
-template<> inline std::string JniSignature<jobject>::signature() { return "Ljava/lang/Object;"; }
+template<> struct JniSignature<unsigned char> : FixedJniSignature<"B", "byte"> {};
+template<> struct JniSignature<char> : FixedJniSignature<"C", "char"> {};
 
-template<> inline std::string JniSignature<void>::typeName() { return "void"; }
-template<> inline std::string JniSignature<short>::typeName() { return "short"; }
-template<> inline std::string JniSignature<int>::typeName() { return "int"; }
-template<> inline std::string JniSignature<long>::typeName() { return "long"; }
+template<> struct JniSignature<float> : FixedJniSignature<"F", "float"> {};
+template<> struct JniSignature<double> : FixedJniSignature<"D", "double"> {};
 
-template<> inline std::string JniSignature<unsigned char>::typeName() { return "byte"; }
-template<> inline std::string JniSignature<char>::typeName() { return "char"; }
+template<> struct JniSignature<bool> : FixedJniSignature<"Z", "boolean"> {};
 
-template<> inline std::string JniSignature<float>::typeName() { return "float"; }
-template<> inline std::string JniSignature<double>::typeName() { return "double"; }
+template<> struct JniSignature<char *> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct JniSignature<const char *> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct JniSignature<std::string> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct JniSignature<const std::string&> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct JniSignature<std::string_view> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct JniSignature<std::u16string_view> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
 
-template<> inline std::string JniSignature<bool>::typeName() { return "boolean"; }
-
-template<> inline std::string JniSignature<char *>::typeName() { return "java.lang.String"; }
-template<> inline std::string JniSignature<const char *>::typeName() { return "java.lang.String"; }
-template<> inline std::string JniSignature<std::string>::typeName() { return "java.lang.String"; }
-template<> inline std::string JniSignature<const std::string&>::typeName() { return "java.lang.String"; }
-
-template<> inline std::string JniSignature<jobject>::typeName() { return "java.lang.Object"; }
+template<> struct JniSignature<jobject> : FixedJniSignature<"Ljava/lang/Object;", "java.lang.Object"> {};
 
 template<> struct JniTypeMapping<std::string> { 
     using jniType = jobject; 
     using actualCppType = std::string;
 };
+//
+// Views are argument (and field set) only types.  There is nothing for a returned view to refer to.
+//
+template<> struct JniTypeMapping<std::string_view> {
+    using jniType = jobject;
+    using actualCppType = std::string_view;
+};
+template<> struct JniTypeMapping<std::u16string_view> {
+    using jniType = jobject;
+    using actualCppType = std::u16string_view;
+};
 template<> struct JniTypeMapping<const char *> {
     using jniType = jobject;
     using actualCppType = const char *;
@@ -282,7 +326,15 @@ inline jchar ToJavaConverter<char>::convertToJava(char val) {
     return jchar(val);
 }
 template <>
-inline jobject ToJavaConverter<std::string>::convertToJava(std::string val) {
+inline jobject ToJavaConverter<std::string>::convertToJava(const std::string& val) {
+    return toJString(val);
+}
+template <>
+inline jobject ToJavaConverter<std::string_view>::convertToJava(std::string_view val) {
+    return toJString(val);
+}
+template <>
+inline jobject ToJavaConverter<std::u16string_view>::convertToJava(std::u16string_view val) {
     return toJString(val);
 }
 template <>
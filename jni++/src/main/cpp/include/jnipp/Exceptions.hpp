@@ -31,6 +31,14 @@ public:
             std::string("No such class '") + name + "' has been cached.") {}
 };
 
+//
+// A class or member couldn't be resolved: it doesn't exist, the signature is wrong or it isn't exported.  Nothing
+// is cached for it, so the binding tries again (and throws again) on its next use.
+//
+class resolution_error : public std::runtime_error {
+public:
+    explicit resolution_error(const std::string &message) : runtime_error(message) {}
+};
 
 struct java_exception_details {
     explicit java_exception_details(const jthrowable &jexception);
@@ -26,7 +26,7 @@ template <typename CppReturnType>
 struct HighLevelInvoker {
     template<typename TargetType>
     static typename JniTypeMapping<CppReturnType>::actualCppType
-    invoke(TargetType target, jmethodID methodID, vector <jvalue> &args, JniLocalReferenceScope &refs);
+    invoke(TargetType target, jmethodID methodID, const jvalue *args, JniLocalReferenceScope &refs);
 };
 
 template <typename CppType>
@@ -38,7 +38,7 @@ struct HighLevelAccessor {
     static actualCppType get(TargetType target, jfieldID fieldID, JniLocalReferenceScope& refs);
 
     template <typename TargetType>
-    static void set(TargetType target, jfieldID fieldID, actualCppType value);
+    static void set(TargetType target, jfieldID fieldID, typename JniArgumentType<CppType>::type value);
 };
 
 
@@ -55,19 +55,19 @@ struct HighLevelAccessor {
 
 template <typename CppReturnType>
 template <typename TargetType>
-typename JniTypeMapping<CppReturnType>::actualCppType HighLevelInvoker<CppReturnType>::invoke(TargetType target, jmethodID methodID, vector<jvalue>& args, JniLocalReferenceScope& refs) {
+typename JniTypeMapping<CppReturnType>::actualCppType HighLevelInvoker<CppReturnType>::invoke(TargetType target, jmethodID methodID, const jvalue* args, JniLocalReferenceScope& refs) {
     using cppType = typename JniTypeMapping<CppReturnType>::actualCppType;
     using jniType = typename JniTypeMapping<CppReturnType>::jniType;
     jniType javaReturnValue = LowLevelInvoker<jniType>::invoke(target, methodID, args);
     checkForExceptions();
     cppType returnValue = ToCppConverter<CppReturnType>::convertToCpp(javaReturnValue);
-    return JvmObjectPassThrough<cppType, IsGlobalRef<CppReturnType>::value>::pass(returnValue, refs);
+    return JvmObjectPassThrough<cppType, IsGlobalRef<CppReturnType>::value>::pass(std::move(returnValue), refs);
 };
 
 
 template <>
 template <typename TargetType>
-inline void HighLevelInvoker<void>::invoke(TargetType target, jmethodID methodID, vector<jvalue>& args, JniLocalReferenceScope& refs) {
+inline void HighLevelInvoker<void>::invoke(TargetType target, jmethodID methodID, const jvalue* args, JniLocalReferenceScope& refs) {
 	LowLevelInvoker<void>::invoke(target, methodID, args);
 	checkForExceptions();
 }
@@ -78,13 +78,13 @@ typename JniTypeMapping<CppValueType>::actualCppType HighLevelAccessor<CppValueT
     jniType javaReturnValue = LowLevelAccessor<jniType>::get(target, fieldID);
     checkForExceptions();
     actualCppType returnValue = ToCppConverter<CppValueType>::convertToCpp(javaReturnValue);
-    return JvmObjectPassThrough<actualCppType, IsGlobalRef<CppValueType>::value>::pass(returnValue, refs);
+    return JvmObjectPassThrough<actualCppType, IsGlobalRef<CppValueType>::value>::pass(std::move(returnValue), refs);
 }
 
 
 template <typename CppValueType>
 template <typename TargetType>
-void HighLevelAccessor<CppValueType>::set(TargetType target, jfieldID fieldID, typename JniTypeMapping<CppValueType>::actualCppType value) {
+void HighLevelAccessor<CppValueType>::set(TargetType target, jfieldID fieldID, typename JniArgumentType<CppValueType>::type value) {
     jniType javaValue = ToJavaConverter<CppValueType>::convertToJava(value);
     LowLevelAccessor<jniType>::set(target, fieldID, javaValue);
     checkForExceptions();
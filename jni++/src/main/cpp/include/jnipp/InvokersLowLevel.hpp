@@ -21,8 +21,8 @@ namespace jni_pp {
 template <typename JavaReturnType>
 struct LowLevelInvoker {
     // Static and Instance method invokers
-    static JavaReturnType invoke(jclass class_, jmethodID methodID, vector <jvalue> &args);
-    static JavaReturnType invoke(jobject object, jmethodID methodID, vector <jvalue> &args);
+    static JavaReturnType invoke(jclass class_, jmethodID methodID, const jvalue *args);
+    static JavaReturnType invoke(jobject object, jmethodID methodID, const jvalue *args);
 };    
 
 template <typename JavaType>
@@ -43,10 +43,14 @@ struct LowLevelAccessor {
     
     // Primitive array get and release
     static JavaType* getElements(jarray array, jboolean* isCopy);
-    static void releaseElements(jarray array, JavaType* elements);
+    // mode is 0 (copy back and free), JNI_COMMIT (copy back) or JNI_ABORT (free without copying back)
+    static void releaseElements(jarray array, JavaType* elements, jint mode = 0);
 
     // Primitive array set
     static void setElements(ArrayType javaArray, JavaType cppArray[], int start, int len);
+
+    // Primitive array region copy out
+    static void getElementsRegion(ArrayType javaArray, int start, int len, JavaType cppArray[]);
 };
 
 
@@ -66,63 +70,63 @@ struct LowLevelAccessor {
 //
 
 template<>
-inline void LowLevelInvoker<void>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	env()->CallStaticVoidMethodA(class_, methodID, args.data());
+inline void LowLevelInvoker<void>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	env()->CallStaticVoidMethodA(class_, methodID, args);
 }
 
 template<>
-inline jboolean LowLevelInvoker<jboolean>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticBooleanMethodA(class_, methodID, args.data());
+inline jboolean LowLevelInvoker<jboolean>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticBooleanMethodA(class_, methodID, args);
 }
 
 template<>
-inline jbyte LowLevelInvoker<jbyte>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticByteMethodA(class_, methodID, args.data());
+inline jbyte LowLevelInvoker<jbyte>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticByteMethodA(class_, methodID, args);
 }
 
 template<>
-inline jchar LowLevelInvoker<jchar>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticCharMethodA(class_, methodID, args.data());
+inline jchar LowLevelInvoker<jchar>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticCharMethodA(class_, methodID, args);
 }
 
 template<>
-inline jshort LowLevelInvoker<jshort>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticShortMethodA(class_, methodID, args.data());
+inline jshort LowLevelInvoker<jshort>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticShortMethodA(class_, methodID, args);
 }
 
 template<>
-inline jint LowLevelInvoker<jint>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticIntMethodA(class_, methodID, args.data());
+inline jint LowLevelInvoker<jint>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticIntMethodA(class_, methodID, args);
 }
 
 template<>
-inline jlong LowLevelInvoker<jlong>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticLongMethodA(class_, methodID, args.data());
+inline jlong LowLevelInvoker<jlong>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticLongMethodA(class_, methodID, args);
 }
 
 template<>
-inline jfloat LowLevelInvoker<jfloat>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticFloatMethodA(class_, methodID, args.data());
+inline jfloat LowLevelInvoker<jfloat>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticFloatMethodA(class_, methodID, args);
 }
 
 template<>
-inline jdouble LowLevelInvoker<jdouble>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallStaticDoubleMethodA(class_, methodID, args.data());
+inline jdouble LowLevelInvoker<jdouble>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+	return env()->CallStaticDoubleMethodA(class_, methodID, args);
 }
 
 template<>
-inline jobject LowLevelInvoker<jobject>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-    return env()->CallStaticObjectMethodA(class_, methodID, args.data());
+inline jobject LowLevelInvoker<jobject>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+    return env()->CallStaticObjectMethodA(class_, methodID, args);
 }
 
 template<>
-inline jarray LowLevelInvoker<jarray>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-    return static_cast<jarray>(env()->CallStaticObjectMethodA(class_, methodID, args.data()));
+inline jarray LowLevelInvoker<jarray>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+    return static_cast<jarray>(env()->CallStaticObjectMethodA(class_, methodID, args));
 }
 
 template<>
-inline jobjectArray LowLevelInvoker<jobjectArray>::invoke(jclass class_, jmethodID methodID, vector<jvalue>& args) {
-    return static_cast<jobjectArray>(env()->CallStaticObjectMethodA(class_, methodID, args.data()));
+inline jobjectArray LowLevelInvoker<jobjectArray>::invoke(jclass class_, jmethodID methodID, const jvalue* args) {
+    return static_cast<jobjectArray>(env()->CallStaticObjectMethodA(class_, methodID, args));
 }
 
 
@@ -131,63 +135,63 @@ inline jobjectArray LowLevelInvoker<jobjectArray>::invoke(jclass class_, jmethod
 //
 
 template<>
-inline void LowLevelInvoker<void>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	env()->CallVoidMethodA(object, methodID, args.data());
+inline void LowLevelInvoker<void>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	env()->CallVoidMethodA(object, methodID, args);
 }
 
 template<>
-inline jboolean LowLevelInvoker<jboolean>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallBooleanMethodA(object, methodID, args.data());
+inline jboolean LowLevelInvoker<jboolean>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallBooleanMethodA(object, methodID, args);
 }
 
 template<>
-inline jbyte LowLevelInvoker<jbyte>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallByteMethodA(object, methodID, args.data());
+inline jbyte LowLevelInvoker<jbyte>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallByteMethodA(object, methodID, args);
 }
 
 template<>
-inline jchar LowLevelInvoker<jchar>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallCharMethodA(object, methodID, args.data());
+inline jchar LowLevelInvoker<jchar>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallCharMethodA(object, methodID, args);
 }
 
 template<>
-inline jshort LowLevelInvoker<jshort>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallShortMethodA(object, methodID, args.data());
+inline jshort LowLevelInvoker<jshort>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallShortMethodA(object, methodID, args);
 }
 
 template<>
-inline jint LowLevelInvoker<jint>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallIntMethodA(object, methodID, args.data());
+inline jint LowLevelInvoker<jint>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallIntMethodA(object, methodID, args);
 }
 
 template<>
-inline jlong LowLevelInvoker<jlong>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallLongMethodA(object, methodID, args.data());
+inline jlong LowLevelInvoker<jlong>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallLongMethodA(object, methodID, args);
 }
 
 template<>
-inline jfloat LowLevelInvoker<jfloat>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallFloatMethodA(object, methodID, args.data());
+inline jfloat LowLevelInvoker<jfloat>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallFloatMethodA(object, methodID, args);
 }
 
 template<>
-inline jdouble LowLevelInvoker<jdouble>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-	return env()->CallDoubleMethodA(object, methodID, args.data());
+inline jdouble LowLevelInvoker<jdouble>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+	return env()->CallDoubleMethodA(object, methodID, args);
 }
 
 template<>
-inline jobject LowLevelInvoker<jobject>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-    return env()->CallObjectMethodA(object, methodID, args.data());
+inline jobject LowLevelInvoker<jobject>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+    return env()->CallObjectMethodA(object, methodID, args);
 }
 
 template<>
-inline jarray LowLevelInvoker<jarray>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-    return static_cast<jarray>(env()->CallObjectMethodA(object, methodID, args.data()));
+inline jarray LowLevelInvoker<jarray>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+    return static_cast<jarray>(env()->CallObjectMethodA(object, methodID, args));
 }
 
 template<>
-inline jobjectArray LowLevelInvoker<jobjectArray>::invoke(jobject object, jmethodID methodID, vector<jvalue>& args) {
-    return static_cast<jobjectArray>(env()->CallObjectMethodA(object, methodID, args.data()));
+inline jobjectArray LowLevelInvoker<jobjectArray>::invoke(jobject object, jmethodID methodID, const jvalue* args) {
+    return static_cast<jobjectArray>(env()->CallObjectMethodA(object, methodID, args));
 }
 
 
@@ -525,43 +529,43 @@ inline jdouble* LowLevelAccessor<jdouble>::getElements(jarray array, jboolean* i
 //
 
 template<>
-inline void LowLevelAccessor<jboolean>::releaseElements(jarray array, jboolean* elements) {
-    env()->ReleaseBooleanArrayElements(static_cast<jbooleanArray>(array), elements, 0);
+inline void LowLevelAccessor<jboolean>::releaseElements(jarray array, jboolean* elements, jint mode) {
+    env()->ReleaseBooleanArrayElements(static_cast<jbooleanArray>(array), elements, mode);
 }
 
 template<>
-inline void LowLevelAccessor<jbyte>::releaseElements(jarray array, jbyte* elements) {
-    env()->ReleaseByteArrayElements(static_cast<jbyteArray>(array), elements, 0);
+inline void LowLevelAccessor<jbyte>::releaseElements(jarray array, jbyte* elements, jint mode) {
+    env()->ReleaseByteArrayElements(static_cast<jbyteArray>(array), elements, mode);
 }
 
 template<>
-inline void LowLevelAccessor<jchar>::releaseElements(jarray array, jchar* elements) {
-    env()->ReleaseCharArrayElements(static_cast<jcharArray>(array), elements, 0);
+inline void LowLevelAccessor<jchar>::releaseElements(jarray array, jchar* elements, jint mode) {
+    env()->ReleaseCharArrayElements(static_cast<jcharArray>(array), elements, mode);
 }
 
 template<>
-inline void LowLevelAccessor<jshort>::releaseElements(jarray array, jshort* elements) {
-    env()->ReleaseShortArrayElements(static_cast<jshortArray>(array), elements, 0);
+inline void LowLevelAccessor<jshort>::releaseElements(jarray array, jshort* elements, jint mode) {
+    env()->ReleaseShortArrayElements(static_cast<jshortArray>(array), elements, mode);
 }
 
 template<>
-inline void LowLevelAccessor<jint>::releaseElements(jarray array, jint* elements) {
-    env()->ReleaseIntArrayElements(static_cast<jintArray>(array), elements, 0);
+inline void LowLevelAccessor<jint>::releaseElements(jarray array, jint* elements, jint mode) {
+    env()->ReleaseIntArrayElements(static_cast<jintArray>(array), elements, mode);
 }
 
 template<>
-inline void LowLevelAccessor<jlong>::releaseElements(jarray array, jlong* elements) {
-    env()->ReleaseLongArrayElements(static_cast<jlongArray>(array), elements, 0);
+inline void LowLevelAccessor<jlong>::releaseElements(jarray array, jlong* elements, jint mode) {
+    env()->ReleaseLongArrayElements(static_cast<jlongArray>(array), elements, mode);
 }
 
 template<>
-inline void LowLevelAccessor<jfloat>::releaseElements(jarray array, jfloat* elements) {
-    env()->ReleaseFloatArrayElements(static_cast<jfloatArray>(array), elements, 0);
+inline void LowLevelAccessor<jfloat>::releaseElements(jarray array, jfloat* elements, jint mode) {
+    env()->ReleaseFloatArrayElements(static_cast<jfloatArray>(array), elements, mode);
 }
 
 template<>
-inline void LowLevelAccessor<jdouble>::releaseElements(jarray array, jdouble* elements) {
-    env()->ReleaseDoubleArrayElements(static_cast<jdoubleArray>(array), elements, 0);
+inline void LowLevelAccessor<jdouble>::releaseElements(jarray array, jdouble* elements, jint mode) {
+    env()->ReleaseDoubleArrayElements(static_cast<jdoubleArray>(array), elements, mode);
 }
 
 //
@@ -610,4 +614,49 @@ inline void LowLevelAccessor<jdouble>::setElements(jdoubleArray javaArray, jdoub
 }
 
 
+//
+// Primitive array elements region getters
+//
+
+template<>
+inline void LowLevelAccessor<jboolean>::getElementsRegion(jbooleanArray javaArray, int start, int len, jboolean cppArray[]) {
+    env()->GetBooleanArrayRegion(javaArray, start, len, cppArray);
+}
+
+template<>
+inline void LowLevelAccessor<jbyte>::getElementsRegion(jbyteArray javaArray, int start, int len, jbyte cppArray[]) {
+    env()->GetByteArrayRegion(javaArray, start, len, cppArray);
+}
+
+template<>
+inline void LowLevelAccessor<jchar>::getElementsRegion(jcharArray javaArray, int start, int len, jchar cppArray[]) {
+    env()->GetCharArrayRegion(javaArray, start, len, cppArray);
+}
+
+template<>
+inline void LowLevelAccessor<jshort>::getElementsRegion(jshortArray javaArray, int start, int len, jshort cppArray[]) {
+    env()->GetShortArrayRegion(javaArray, start, len, cppArray);
+}
+
+template<>
+inline void LowLevelAccessor<jint>::getElementsRegion(jintArray javaArray, int start, int len, jint cppArray[]) {
+    env()->GetIntArrayRegion(javaArray, start, len, cppArray);
+}
+
+template<>
+inline void LowLevelAccessor<jlong>::getElementsRegion(jlongArray javaArray, int start, int len, jlong cppArray[]) {
+    env()->GetLongArrayRegion(javaArray, start, len, cppArray);
+}
+
+template<>
+inline void LowLevelAccessor<jfloat>::getElementsRegion(jfloatArray javaArray, int start, int len, jfloat cppArray[]) {
+    env()->GetFloatArrayRegion(javaArray, start, len, cppArray);
+}
+
+template<>
+inline void LowLevelAccessor<jdouble>::getElementsRegion(jdoubleArray javaArray, int start, int len, jdouble cppArray[]) {
+    env()->GetDoubleArrayRegion(javaArray, start, len, cppArray);
+}
+
+
 } // namespace jni_pp
@@ -55,13 +55,18 @@ struct IsGlobalRef<JvmObject<name, global>> {
     static constexpr bool value = global;
 };
 
+template<LiteralName name, bool global>
+struct CreatesLocalReferences<JvmObject<name, global>> {
+    static constexpr bool value = false;
+};
+
 template<LiteralName name, bool global>
 struct JniSignature<JvmObject<name, global>> {
-    std::string signature() {
+    static constexpr auto signature() {
         return JvmClassNameToJniSignature(typeName());
     }
-    std::string typeName() {
-        return getName<name>();
+    static constexpr auto typeName() {
+        return FixedString(name.value);
     }
 };
 template<LiteralName name, bool global>
@@ -89,11 +94,11 @@ struct JniMapping {
 
 template<typename CppType, LiteralName name>
 struct JniSignature<JniMapping<CppType, name>> {
-    std::string signature() {
+    static constexpr auto signature() {
         return JvmClassNameToJniSignature(typeName());
     }
-    std::string typeName() {
-        return getName<name>();
+    static constexpr auto typeName() {
+        return FixedString(name.value);
     }
 };
 
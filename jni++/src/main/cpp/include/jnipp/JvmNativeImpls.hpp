@@ -42,3 +42,11 @@ extern "C"
 JNIEXPORT jint JNICALL
 Java_dev_tmich_jnipp_JavaToNativeExporter_nativeThreadWrapper(JNIEnv *, jclass, jlong);
 
+extern "C"
+JNIEXPORT void JNICALL
+Java_dev_tmich_jnipp_JavaToNativeExporter_releasePooledBuffer(JNIEnv *env, jclass clazz, jobject buffer);
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_dev_tmich_jnipp_JavaToNativeExporter_releasePooledBlock(JNIEnv *env, jclass clazz, jlong address, jlong generation);
+
@@ -16,14 +16,21 @@
 
 class JniLocalReferenceScope {
 public:
-	explicit JniLocalReferenceScope(int capacity) {
+	explicit JniLocalReferenceScope(int capacity) : JniLocalReferenceScope(capacity, true) {}
+	JniLocalReferenceScope() : JniLocalReferenceScope(16) {}
+
+	// If pushFrame is false no frame is pushed and releaseLocalRefs just passes references through.  Used when it is
+	// known at compile time that nothing will create local references (see NeedsLocalFrame).
+	JniLocalReferenceScope(int capacity, bool pushFrame) {
+        if (!pushFrame) {
+            return;
+        }
         if (jni_pp::env()->PushLocalFrame(capacity)) {
             jni_pp::log_print(jni_pp::LOG_ERROR, "PushLocalFrame failed, out of memory.  Punting.");
             return;
         }
         framePushed = true;
     }
-	JniLocalReferenceScope() : JniLocalReferenceScope(16) {}
 
 	~JniLocalReferenceScope() {
 		(void) releaseLocalRefs(nullptr);
@@ -0,0 +1,86 @@
+//
+// ResolutionManifest.hpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#pragma once
+
+#include <jni.h>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace jni_pp {
+
+//
+// Opt-in on-disk record of members that had to be found with the reflective lookup in JavaToNativeExporter (no
+// signature, or a signature that didn't match).  Each entry holds the exact JNI descriptor the member resolved to,
+// keyed by class, member name, static-ness, number of parameters and the signature that was tried, along with a
+// fingerprint of the class file (and its superclasses).  On later starts getMethodInfo/getFieldInfo use the recorded
+// descriptor directly with GetMethodID/GetFieldID.  Entries whose fingerprint no longer matches, or whose descriptor
+// no longer resolves, are ignored and replaced by the result of the normal reflective lookup.
+//
+// Exportability (ExportToNative) is still checked for members resolved through the manifest.
+//
+// Classes without a fingerprint (class files that aren't readable as resources, as on Android) are never recorded.
+//
+
+//
+// Load the manifest at path (if it exists) and start using and recording entries.  An empty path turns the manifest
+// off.  Set it before the library is loaded (or before warmup) so that it is used for the initial lookups.
+//
+void setResolutionManifest(const std::string& path);
+const std::string& getResolutionManifest();
+
+// Write the current entries to the manifest path.  Returns false if there is no path or the file couldn't be written.
+bool saveResolutionManifest();
+
+typedef struct ResolutionManifestStats {
+    size_t entries;     // Entries currently held (loaded or recorded)
+    size_t hits;        // Lookups resolved from the manifest
+    size_t stale;       // Entries ignored because the class changed or the descriptor no longer resolved
+    size_t recorded;    // Entries added or replaced after a reflective lookup
+} ResolutionManifestStats;
+
+ResolutionManifestStats getResolutionManifestStats();
+
+//
+// Internal use only, by getMethodInfo and getFieldInfo.
+//
+typedef enum ManifestMemberKind {
+    MANIFEST_METHOD,
+    MANIFEST_STATIC_METHOD,
+    MANIFEST_FIELD,
+    MANIFEST_STATIC_FIELD
+} ManifestMemberKind;
+
+typedef struct ManifestMember {
+    ManifestMemberKind kind;
+    const std::string& className;
+    const std::string& memberName;
+    std::string_view requestedSignature;
+    int numParameters;
+} ManifestMember;
+
+bool isResolutionManifestEnabled();
+
+// Is there an entry for member, whether or not it is still current
+bool hasManifestDescriptor(const ManifestMember& member);
+
+// The recorded descriptor, if there is one and the class hasn't changed since it was recorded
+std::optional<std::string> findManifestDescriptor(const ManifestMember& member);
+
+// The recorded descriptor didn't resolve, drop it
+void discardManifestDescriptor(const ManifestMember& member);
+
+// Record the descriptor of member, a java.lang.reflect.Method, Constructor or Field
+void recordManifestDescriptor(const ManifestMember& member, jobject reflectedMember);
+
+} // namespace jni_pp
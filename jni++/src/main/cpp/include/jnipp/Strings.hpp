@@ -0,0 +1,340 @@
+//
+// Strings.hpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#pragma once
+
+#include <jni.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "jnipp/Bindings.hpp"
+#include "jnipp/Converters.hpp"
+#include "jnipp/JniMapping.hpp"
+
+namespace jni_pp {
+
+//
+// A Java string that is created once, kept as a global reference and then passed to every call as is.  For argument
+// values that never change (keys, format strings, enum names, ...) this avoids the NewStringUTF, and the local
+// reference frame, that a std::string argument costs on every call.
+//
+//     static InternedJString kKey("user.name");
+//     static StaticMethod<std::string, InternedJString> jGetProperty("java.lang.System", "getProperty");
+//     std::string user = jGetProperty(kKey);
+//
+// The Java string is created on first use (or by warmup(), it is a Binding) so these can be constructed before the
+// VM is available.
+//
+class InternedJString : public Binding {
+public:
+    explicit InternedJString(std::string value);
+    ~InternedJString() override;
+
+    /// @brief Create the Java string now rather than on first use (see warmup()).
+    void resolve() override {
+        get();
+    }
+
+    /// @return Global reference to the Java string.  Owned by this object, do not delete it.
+    jstring get() const;
+
+    const std::string& str() const {
+        return value;
+    }
+
+private:
+    const std::string value;
+    mutable jstring javaString = nullptr;
+    mutable std::once_flag runOnce;
+};
+
+//
+// Compile time version of InternedJString.  Each distinct literal has one shared InternedJString.  It can be used as
+// the argument type itself, in which case the value is fixed by the type and the caller just passes {}:
+//
+//     static StaticMethod<std::string, JavaStringConst<"user.name">> jGetUserName("java.lang.System", "getProperty");
+//     std::string user = jGetUserName({});
+//
+// or passed anywhere an InternedJString argument is expected.
+//
+template<LiteralName literal>
+struct JavaStringConst {
+    static const InternedJString& interned() {
+        // Leaked so it is still valid for bindings used during static destruction
+        static auto *instance = new InternedJString(literal.value);
+        return *instance;
+    }
+
+    operator const InternedJString&() const {
+        return interned();
+    }
+};
+
+
+//
+// Opt-in deduplication of string results, for calls that keep returning the same few values (status codes, type
+// names, enum name()s, ...).  Declare the return (or field) type as DedupString and the result is a shared, immutable
+// std::string:
+//
+//     static InstanceMethod<DedupString> jName("java.lang.Enum", "name");
+//     SharedString name = jName(state);
+//
+// The contents of the Java string are copied to the stack with GetStringRegion and looked up by hash in a bounded
+// concurrent cache.  A hit costs that copy and a lookup, no transcoding and no allocation.  Strings longer than
+// kMaxDedupUnits code units are converted as usual and not cached.
+//
+struct DedupString {};
+typedef std::shared_ptr<const std::string> SharedString;
+
+constexpr size_t kMaxDedupUnits = 256;
+
+// Null for a null Java string
+SharedString dedupJString(jstring s);
+
+// Most entries the cache holds, 4096 by default.  When a part of the cache fills up it is emptied.
+void setStringCacheCapacity(size_t entries);
+void clearStringCache();
+
+typedef struct StringCacheStats {
+    size_t entries;     // Strings currently cached
+    size_t hits;        // Results found in the cache
+    size_t misses;      // Results converted and added to the cache
+    size_t uncached;    // Results too long to cache
+} StringCacheStats;
+
+StringCacheStats getStringCacheStats();
+
+//
+// Whole String[] conversions in one JNI call each way, instead of a GetObjectArrayElement (or SetObjectArrayElement),
+// local frame and conversion per element.  A helper in JavaToNativeExporter packs the strings into a single byte[]
+// of length prefixed UTF-8 (or unpacks one into a String[]).  Large arrays are unpacked on several threads.
+//
+// Null elements become empty strings.  Arrays too large to pack into one byte[] throw, std::length_error from
+// vectorToJStringArray and java_exception (of an ArithmeticException) from jStringArrayToVector.
+// std::vector<std::string> can also be used directly as an argument, return or field type for String[].
+//
+std::vector<std::string> jStringArrayToVector(jobjectArray array);
+jobjectArray vectorToJStringArray(const std::vector<std::string>& strings);
+
+//
+// Streaming conversion of large strings (multi-megabyte JSON documents, ...).  The string is read with GetStringRegion
+// chunkUnits UTF-16 code units at a time, each chunk is converted to UTF-8 and handed to the sink before the next one
+// is read.  Memory use is bounded by the chunk size rather than the string and the sink can start consuming before
+// the whole string has been copied.  Chunks never split a character.
+//
+// The sink returns false to stop early.  The sink may make JNI calls.  Returns the number of UTF-8 bytes passed to
+// the sink.  A null s passes nothing.
+//
+// To convert into a preallocated buffer use jStringToBuffer, which doesn't make an intermediate copy at all.
+//
+typedef std::function<bool(std::string_view chunk)> StringChunkSink;
+
+constexpr size_t kStreamChunkUnits = 8 * 1024;
+
+size_t streamJString(jstring s, const StringChunkSink& sink, size_t chunkUnits = kStreamChunkUnits);
+
+// Write each chunk to out, stopping if out fails
+size_t streamJString(jstring s, std::ostream& out, size_t chunkUnits = kStreamChunkUnits);
+
+//
+// A Java string returned (or read from a field) without converting it.  Holds a reference to the jstring and only
+// converts when asked, so a call site that just compares, measures or forwards the result never transcodes it:
+//
+//     static StaticMethod<JavaString, std::string> jGetProperty("java.lang.System", "getProperty");
+//     if (jGetProperty("os.name").equals("Linux")) { ... }
+//
+// A returned JavaString holds a local reference in the caller's frame, so it has to be used on the calling thread
+// before the native method returns.  Use global() to keep it longer.  Move only, the reference is deleted when it is
+// destroyed.
+//
+class JavaString {
+public:
+    class Utf16View;
+
+    JavaString() = default;
+
+    // Takes ownership of javaString
+    explicit JavaString(jstring javaString, bool globalRef = false) : javaString(javaString), globalRef(globalRef) {}
+
+    JavaString(JavaString&& other) noexcept;
+    JavaString& operator=(JavaString&& other) noexcept;
+    JavaString(const JavaString&) = delete;
+    JavaString& operator=(const JavaString&) = delete;
+    ~JavaString();
+
+    /// @return The reference, still owned by this object.  Null for a null Java string.
+    jstring get() const {
+        return javaString;
+    }
+
+    explicit operator bool() const {
+        return javaString != nullptr;
+    }
+
+    /// @return The reference, no longer owned by this object.
+    jstring release();
+
+    /// @return A new JavaString holding a global reference to the same string, usable on any thread.
+    JavaString global() const;
+
+    /// @return Length in UTF-16 code units (GetStringLength), 0 for null.
+    size_t length() const;
+
+    /// @return The string as UTF-8, converted on first use and then kept.  Empty for null.
+    const std::string& utf8() const;
+
+    /// @return Whether the string is (in UTF-8) exactly utf8.  Doesn't allocate.  A null string equals nothing.
+    bool equals(std::string_view utf8) const;
+
+    /// @return The UTF-16 contents, directly from the JVM with GetStringCritical.  See Utf16View.
+    Utf16View utf16_view() const;
+
+    /// @brief Convert to UTF-8 a chunk at a time, see streamJString.
+    size_t stream(const StringChunkSink& sink, size_t chunkUnits = kStreamChunkUnits) const;
+    size_t stream(std::ostream& out, size_t chunkUnits = kStreamChunkUnits) const;
+
+private:
+    jstring javaString = nullptr;
+    bool globalRef = false;
+    mutable std::optional<std::string> converted;
+};
+
+//
+// The contents of a JavaString, pinned (or copied by the JVM) with GetStringCritical until the view is destroyed.  As
+// for any critical region, no other JNI calls may be made on the thread and it shouldn't be held for long.
+//
+class JavaString::Utf16View {
+public:
+    Utf16View(Utf16View&& other) noexcept;
+    Utf16View(const Utf16View&) = delete;
+    Utf16View& operator=(const Utf16View&) = delete;
+    Utf16View& operator=(Utf16View&&) = delete;
+    ~Utf16View();
+
+    const char16_t *data() const {
+        return chars;
+    }
+    size_t size() const {
+        return length;
+    }
+    std::u16string_view view() const {
+        return std::u16string_view(chars, length);
+    }
+    operator std::u16string_view() const {
+        return view();
+    }
+
+private:
+    friend class JavaString;
+    Utf16View(jstring javaString, size_t length);
+
+    jstring javaString;
+    const char16_t *chars = nullptr;
+    size_t length;
+};
+
+
+//#################################################################################################
+//#################################################################################################
+//########
+//########                  Implementation details
+//########
+//#################################################################################################
+//#################################################################################################
+
+
+template<> struct JniTypeMapping<InternedJString> {
+    using actualCppType = const InternedJString&;
+    using jniType = jobject;
+};
+template<> struct CreatesLocalReferences<InternedJString> { static constexpr bool value = false; };
+template<> struct JniSignature<InternedJString> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct ToJavaConverter<InternedJString> {
+    static jobject convertToJava(const InternedJString& value) {
+        return value.get();
+    }
+};
+
+template<LiteralName literal> struct JniTypeMapping<JavaStringConst<literal>> {
+    using actualCppType = JavaStringConst<literal>;
+    using jniType = jobject;
+};
+template<LiteralName literal> struct CreatesLocalReferences<JavaStringConst<literal>> { static constexpr bool value = false; };
+template<LiteralName literal> struct JniSignature<JavaStringConst<literal>> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<LiteralName literal> struct ToJavaConverter<JavaStringConst<literal>> {
+    static jobject convertToJava(JavaStringConst<literal>) {
+        return JavaStringConst<literal>::interned().get();
+    }
+};
+
+template<> struct JniTypeMapping<JavaString> {
+    using actualCppType = JavaString;
+    using jniType = jobject;
+};
+template<> struct JniSignature<JavaString> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct ToCppConverter<JavaString> {
+    static JavaString convertToCpp(jobject val) {
+        return JavaString(static_cast<jstring>(val));
+    }
+};
+template<> struct ToJavaConverter<JavaString> {
+    static jobject convertToJava(const JavaString& value) {
+        return value.get();
+    }
+};
+
+template<> struct JniTypeMapping<DedupString> {
+    using actualCppType = SharedString;
+    using jniType = jobject;
+};
+template<> struct JniSignature<DedupString> : FixedJniSignature<"Ljava/lang/String;", "java.lang.String"> {};
+template<> struct ToCppConverter<DedupString> {
+    static SharedString convertToCpp(jobject val) {
+        SharedString result = dedupJString(static_cast<jstring>(val));
+        env()->DeleteLocalRef(val);
+        return result;
+    }
+};
+
+template<> struct JniTypeMapping<std::vector<std::string>> {
+    using actualCppType = std::vector<std::string>;
+    using jniType = jobject;
+};
+template<> struct JniSignature<std::vector<std::string>> : FixedJniSignature<"[Ljava/lang/String;", "java.lang.String[]"> {};
+template<> struct ToCppConverter<std::vector<std::string>> {
+    static std::vector<std::string> convertToCpp(jobject val) {
+        std::vector<std::string> result = jStringArrayToVector(static_cast<jobjectArray>(val));
+        env()->DeleteLocalRef(val);
+        return result;
+    }
+};
+template<> struct ToJavaConverter<std::vector<std::string>> {
+    static jobject convertToJava(const std::vector<std::string>& value) {
+        return vectorToJStringArray(value);
+    }
+};
+
+// Like a jobject return, pop the call's frame early and keep the reference in the caller's frame
+template<bool global>
+struct JvmObjectPassThrough<JavaString, global> {
+    static JavaString pass(JavaString returnValue, JniLocalReferenceScope& refs) {
+        jstring javaString = returnValue.release();
+        return JavaString(static_cast<jstring>(refs.releaseLocalRefs(javaString)));
+    }
+};
+
+} // namespace jni_pp
@@ -27,11 +27,11 @@ struct SwigMapping {
 
 template<typename CppType, LiteralName name>
 struct JniSignature<SwigMapping<CppType, name>> {
-    std::string signature() {
+    static constexpr auto signature() {
         return JvmClassNameToJniSignature(typeName());
     }
-    std::string typeName() {
-        return getName<name>();
+    static constexpr auto typeName() {
+        return FixedString(name.value);
     }
 };
 
@@ -0,0 +1,61 @@
+//
+// Utf.hpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace jni_pp {
+
+//
+// Transcoding between Java's UTF-16 and standard UTF-8.  This is what jStringToString and toJString use instead of
+// the JNI "UTF" functions, which use modified UTF-8 (NUL as two bytes and supplementary characters as a pair of
+// three byte surrogates) and always copy through a temporary JVM buffer.
+//
+// Runs of ASCII are converted 16 (or 8, or 4) code units at a time, with SSE2 or NEON when available.
+//
+// Invalid input is replaced rather than rejected: unpaired surrogates in UTF-16 and malformed sequences in UTF-8
+// (overlong forms, encoded surrogates, values above U+10FFFF, truncated sequences) become U+FFFD.
+//
+
+// Most UTF-8 bytes that length UTF-16 code units can need
+constexpr size_t maxUtf8Length(size_t utf16Length) {
+    return 3 * utf16Length;
+}
+
+// Most UTF-16 code units that length bytes of UTF-8 can need
+constexpr size_t maxUtf16Length(size_t utf8Length) {
+    return utf8Length;
+}
+
+// Exact number of UTF-8 bytes utf16ToUtf8 will write for this input
+size_t utf8Length(const char16_t *utf16, size_t length);
+
+// Convert to UTF-8.  utf8 must have room for utf8Length (or maxUtf8Length) bytes.  Returns the number written.
+size_t utf16ToUtf8(const char16_t *utf16, size_t length, char *utf8);
+
+// Replace the contents of out with the UTF-8 conversion.  out is sized exactly once.
+void utf16ToUtf8(const char16_t *utf16, size_t length, std::string& out);
+
+// Does the UTF-16 input convert to exactly these UTF-8 bytes?  Converts in small blocks on the stack, no allocation.
+bool utf16EqualsUtf8(const char16_t *utf16, size_t utf16Length, const char *utf8, size_t utf8Length);
+
+// Convert to UTF-16.  utf16 must have room for maxUtf16Length(length) code units.  Returns the number written.
+size_t utf8ToUtf16(const char *utf8, size_t length, char16_t *utf16);
+
+// Is all of the input ASCII?
+bool isAscii(const char *utf8, size_t length);
+
+// Widen ASCII (checked with isAscii) to UTF-16.  utf16 must have room for length code units.
+void asciiToUtf16(const char *ascii, size_t length, char16_t *utf16);
+
+} // namespace jni_pp
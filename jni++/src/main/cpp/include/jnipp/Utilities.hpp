@@ -13,7 +13,10 @@
 #pragma once
 
 #include <jni.h>
+#include <algorithm>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
 #include <cassert>
@@ -76,8 +79,28 @@ typedef struct FieldInfo {
 } FieldInfo;
 
 jclass getClass(const std::string &name);
-MethodInfo *getMethodInfo(const std::string& className, const std::string& methodName, const std::string& signature, bool isStatic, int numParameters);
-FieldInfo *getFieldInfo(const std::string& className, const std::string& fieldName, const std::string& signature, bool isStatic);
+MethodInfo *getMethodInfo(const std::string& className, const std::string& methodName, std::string_view signature, bool isStatic, int numParameters);
+FieldInfo *getFieldInfo(const std::string& className, const std::string& fieldName, std::string_view signature, bool isStatic);
+
+//
+// A method, constructor ("<init>") or field to resolve with resolveMembers.  numParameters is -1 for fields.
+//
+typedef struct MemberRequest {
+    std::string className;
+    std::string memberName;
+    std::string signature;
+    bool isStatic;
+    int numParameters;
+} MemberRequest;
+
+//
+// Resolve and cache a set of members so that later getMethodInfo/getFieldInfo calls for them are cache hits.  Members
+// whose signature resolves directly (or that are in the resolution manifest) are left to the normal path.  All of the
+// rest are looked up reflectively with a single call into JavaToNativeExporter.lookupJavaMembers rather than one
+// call each.  Members that can't be found are skipped and fail as usual on first use.  Returns the number of
+// requests that are now cached.
+//
+size_t resolveMembers(const std::vector<MemberRequest>& requests);
 
 void setPackageBase(const std::string& packageName);
 const std::string& getPackageBase();
@@ -95,4 +118,41 @@ inline std::string JvmClassNameToJniSignature(const std::string& className, bool
     return classDescriptor;
 }
 
+//
+// Fixed size, null terminated string that can be built at compile time and used as a non-type template parameter.
+// N includes the terminating null (same as a string literal).  Used for JNI signatures so they live in static
+// storage instead of being assembled at runtime.
+//
+template<size_t N>
+struct FixedString {
+    constexpr FixedString() = default;
+    constexpr FixedString(const char (&str)[N]) {
+        std::copy_n(str, N, value);
+    }
+
+    static constexpr size_t length() { return N - 1; }
+    constexpr std::string_view view() const { return {value, N - 1}; }
+    constexpr const char *c_str() const { return value; }
+
+    char value[N] {};
+};
+
+template<size_t... Ns>
+constexpr FixedString<(Ns + ... + 1) - sizeof...(Ns)> concatFixedStrings(const FixedString<Ns>&... parts) {
+    FixedString<(Ns + ... + 1) - sizeof...(Ns)> result;
+    size_t pos = 0;
+    ((pos = std::copy_n(parts.value, Ns - 1, result.value + pos) - result.value), ...);
+    return result;
+}
+
+// Compile time version of JvmClassNameToJniSignature(className, true)
+template<size_t N>
+constexpr FixedString<N + 2> JvmClassNameToJniSignature(const FixedString<N>& className) {
+    FixedString<N + 2> descriptor;
+    descriptor.value[0] = 'L';
+    std::replace_copy(className.value, className.value + N - 1, descriptor.value + 1, '.', '/');
+    descriptor.value[N] = ';';
+    return descriptor;
+}
+
 } // namespace jni_pp
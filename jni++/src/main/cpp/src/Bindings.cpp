@@ -0,0 +1,189 @@
+//
+// Bindings.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "jnipp/Bindings.hpp"
+#include "jnipp/Utilities.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace jni_pp {
+
+struct BindingRegistry {
+    std::mutex mutex;
+    std::condition_variable resolvedCV;
+    std::unordered_set<Binding*> bindings;
+    Binding *resolving = nullptr;
+
+    // Only one warmup at a time
+    std::mutex warmupMutex;
+    std::thread backgroundThread;
+};
+
+//
+// Bindings are often globals so they register during static initialization and unregister during static destruction.
+// Intentionally leaked so it is available for both no matter what order other translation units are initialized in.
+//
+static BindingRegistry& registry() {
+    static auto *instance = new BindingRegistry();
+    return *instance;
+}
+
+static WarmupMode warmupMode = WARMUP_NONE;
+
+void registerBinding(Binding *binding) {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.bindings.insert(binding);
+}
+
+void unregisterBinding(Binding *binding) {
+    auto& r = registry();
+    std::unique_lock<std::mutex> lock(r.mutex);
+    r.bindings.erase(binding);
+    r.resolvedCV.wait(lock, [&] { return r.resolving != binding; });
+}
+
+size_t registeredBindingCount() {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    return r.bindings.size();
+}
+
+void setWarmupMode(WarmupMode mode) {
+    warmupMode = mode;
+}
+
+WarmupMode getWarmupMode() {
+    return warmupMode;
+}
+
+size_t warmup() {
+    auto& r = registry();
+    std::lock_guard<std::mutex> warmupLock(r.warmupMutex);
+    // Taken once up front, so nothing below can throw while a binding is marked as being resolved
+    JNIEnv *jniEnv = env();
+
+    std::vector<Binding*> pending;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        pending.assign(r.bindings.begin(), r.bindings.end());
+    }
+
+    //
+    // Resolve the members the bindings describe as one batch first.  The per-binding resolve below is then just a
+    // cache hit for them.  describeMember doesn't call into Java so it is called with the lock held, which also keeps
+    // the bindings from being destroyed meanwhile.
+    //
+    std::vector<MemberRequest> requests;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (Binding *binding : pending) {
+            MemberRequest request;
+            if (r.bindings.find(binding) != r.bindings.end() && binding->describeMember(request)) {
+                requests.push_back(std::move(request));
+            }
+        }
+    }
+    try {
+        resolveMembers(requests);
+    } catch (const std::exception& ex) {
+        log_print(LOG_WARN, "warmup: batch resolve failed: %s", ex.what());
+    }
+    if (jniEnv->ExceptionCheck()) {
+        jniEnv->ExceptionClear();
+    }
+
+    //
+    // The registry lock is not held while resolving.  Resolving can call into Java, which can call native code that
+    // constructs (and registers) more bindings.  Instead, mark the binding being resolved so that a thread destroying
+    // it waits until we are done.
+    //
+    size_t resolved = 0;
+    for (Binding *binding : pending) {
+        {
+            std::lock_guard<std::mutex> lock(r.mutex);
+            if (r.bindings.find(binding) == r.bindings.end()) {
+                continue;  // Destroyed since we took the snapshot
+            }
+            r.resolving = binding;
+        }
+
+        try {
+            binding->resolve();
+            ++resolved;
+        } catch (const std::exception& ex) {
+            log_print(LOG_WARN, "warmup: binding failed to resolve: %s", ex.what());
+        } catch (...) {
+            log_print(LOG_WARN, "warmup: binding failed to resolve.");
+        }
+        if (jniEnv->ExceptionCheck()) {
+            log_print(LOG_WARN, "warmup: Java exception while resolving binding.  Clearing it.");
+            jniEnv->ExceptionClear();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.resolving = nullptr;
+        }
+        r.resolvedCV.notify_all();
+    }
+
+    log_print(LOG_DEBUG, "warmup: resolved %zu of %zu bindings.", resolved, pending.size());
+    return resolved;
+}
+
+void warmupInBackground() {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (r.backgroundThread.joinable()) {
+        return;  // Already started
+    }
+    r.backgroundThread = std::thread([] {
+        // Nothing may escape the thread, that would terminate the process
+        bool doDetachThread = false;
+        try {
+            doDetachThread = attachCurrentThread();
+            warmup();
+        } catch (const std::exception& ex) {
+            log_print(LOG_WARN, "warmup: background warmup failed: %s", ex.what());
+        } catch (...) {
+            log_print(LOG_WARN, "warmup: background warmup failed.");
+        }
+        if (doDetachThread) {
+            try {
+                detachCurrentThread();
+            } catch (...) {} // Best effort, ignore errors
+        }
+    });
+}
+
+void waitForWarmup() {
+    auto& r = registry();
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        thread.swap(r.backgroundThread);
+    }
+    if (!thread.joinable()) {
+        return;
+    }
+    if (thread.get_id() == std::this_thread::get_id()) {
+        thread.detach();  // Called from the warmup thread itself, nothing to wait for
+    } else {
+        thread.join();
+    }
+}
+
+} // namespace jni_pp
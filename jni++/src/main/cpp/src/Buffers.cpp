@@ -0,0 +1,231 @@
+//
+// Buffers.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "jnipp/Buffers.hpp"
+#include "JniPlusPlus.hpp"
+#include "jnipp/Utilities.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace jni_pp {
+
+jobject toJavaByteBuffer(const DirectBuffer& buffer) {
+    if (buffer.data() == nullptr) {
+        return nullptr;
+    }
+    jobject byteBuffer = env()->NewDirectByteBuffer(buffer.data(), jlong(buffer.size()));
+    if (byteBuffer == nullptr) {
+        throw std::runtime_error("NewDirectByteBuffer failed, direct buffers may not be supported by this VM");
+    }
+    return byteBuffer;
+}
+
+DirectBuffer fromJavaByteBuffer(jobject byteBuffer) {
+    if (byteBuffer == nullptr) {
+        return DirectBuffer();
+    }
+    void *address = env()->GetDirectBufferAddress(byteBuffer);
+    if (address == nullptr) {
+        throw std::runtime_error("ByteBuffer is not a direct buffer");
+    }
+    return DirectBuffer(address, size_t(env()->GetDirectBufferCapacity(byteBuffer)));
+}
+
+//
+// Pools.  All pools share one mutex, which also guards the map from slab addresses to slabs used to find the block
+// of a buffer Java releases.  Lending and releasing are a few pointer operations under it, JNI calls are made
+// outside it.
+//
+
+struct DirectBufferPool::Block {
+    std::byte *data = nullptr;
+    uint64_t generation = 0;        // Non zero while in use, unique to each lend
+    jobject cachedBuffer = nullptr; // Global reference to the ByteBuffer lend() reuses
+};
+
+struct DirectBufferPool::Slab {
+    DirectBufferPool *pool = nullptr;
+    std::byte *memory = nullptr;
+    std::vector<Block> blocks;
+};
+
+// Blocks are cache line aligned so neighbouring blocks written by different threads don't share a line
+static constexpr size_t kBlockAlignment = 64;
+
+static std::mutex& poolMutex() {
+    static auto *instance = new std::mutex();
+    return *instance;
+}
+
+static uint64_t nextGeneration = 1;
+
+InstanceMethod<jobject> jClearBuffer("java.nio.Buffer", "clear", "()Ljava/nio/Buffer;");
+StaticMethod<void, jobject, jlong, jlong> jTrackPooledBuffer("dev.tmich.jnipp.JavaToNativeExporter", "trackPooledBuffer", "(Ljava/nio/ByteBuffer;JJ)V");
+
+std::map<const std::byte *, DirectBufferPool::Slab *>& DirectBufferPool::slabsByAddress() {
+    static auto *instance = new std::map<const std::byte *, Slab *>();
+    return *instance;
+}
+
+DirectBufferPool::DirectBufferPool(size_t blockSize, size_t blocksPerSlab, size_t maxSlabs) :
+        blockBytes(blockSize),
+        blockStride((std::max<size_t>(blockSize, 1) + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment),
+        blocksPerSlab(std::max<size_t>(blocksPerSlab, 1)),
+        maxSlabs(maxSlabs) {}
+
+DirectBufferPool::~DirectBufferPool() {
+    std::vector<jobject> cachedBuffers;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex());
+        if (inUse != 0) {
+            log_print(LOG_WARN, "DirectBufferPool destroyed while %zu blocks are still in use", inUse);
+        }
+        for (auto& slab : slabs) {
+            slabsByAddress().erase(slab->memory);
+            for (auto& block : slab->blocks) {
+                if (block.cachedBuffer != nullptr) {
+                    cachedBuffers.push_back(block.cachedBuffer);
+                }
+            }
+        }
+    }
+    // Often static, so only clean up if the VM is still around.  Otherwise env() would wait for one.
+    if (!cachedBuffers.empty() && isEnvSetup()) {
+        try {
+            for (jobject cachedBuffer : cachedBuffers) {
+                env()->DeleteGlobalRef(cachedBuffer);
+            }
+        } catch (...) {} // Best effort, ignore errors
+    }
+    for (auto& slab : slabs) {
+        ::operator delete(slab->memory, std::align_val_t(kBlockAlignment));
+    }
+}
+
+// Called with poolMutex held
+void DirectBufferPool::addSlab() {
+    auto slab = std::make_unique<Slab>();
+    slab->pool = this;
+    slab->memory = static_cast<std::byte *>(::operator new(blockStride * blocksPerSlab, std::align_val_t(kBlockAlignment)));
+    slab->blocks.resize(blocksPerSlab);
+    for (size_t i = 0; i < blocksPerSlab; ++i) {
+        slab->blocks[i].data = slab->memory + i * blockStride;
+    }
+
+    // Room for every block up front, so releasing never allocates
+    freeBlocks.reserve((slabs.size() + 1) * blocksPerSlab);
+    for (size_t i = blocksPerSlab; i > 0; --i) {
+        freeBlocks.push_back(&slab->blocks[i - 1]);
+    }
+    slabsByAddress()[slab->memory] = slab.get();
+    slabs.push_back(std::move(slab));
+}
+
+DirectBufferPool::Block *DirectBufferPool::acquireBlock() {
+    std::lock_guard<std::mutex> lock(poolMutex());
+    if (freeBlocks.empty()) {
+        if (maxSlabs != 0 && slabs.size() >= maxSlabs) {
+            throw std::runtime_error("DirectBufferPool exhausted, all " + std::to_string(slabs.size() * blocksPerSlab) + " blocks are in use");
+        }
+        addSlab();
+    }
+    Block *block = freeBlocks.back();
+    freeBlocks.pop_back();
+    block->generation = nextGeneration++;
+    peakInUse = std::max(peakInUse, ++inUse);
+    return block;
+}
+
+DirectBuffer DirectBufferPool::acquire() {
+    return DirectBuffer(acquireBlock()->data, blockBytes);
+}
+
+jobject DirectBufferPool::lend() {
+    Block *block = acquireBlock();
+    try {
+        // The block is ours until released, so its cached buffer is used without the lock
+        if (block->cachedBuffer != nullptr) {
+            env()->DeleteLocalRef(jClearBuffer(block->cachedBuffer));
+            return env()->NewLocalRef(block->cachedBuffer);
+        }
+        jobject byteBuffer = toJavaByteBuffer(DirectBuffer(block->data, blockBytes));
+        block->cachedBuffer = env()->NewGlobalRef(byteBuffer);
+        return byteBuffer;
+    } catch (...) {
+        releasePooledBlock(block->data, block->generation);
+        throw;
+    }
+}
+
+jobject DirectBufferPool::lendTracked() {
+    Block *block = acquireBlock();
+    jobject byteBuffer = nullptr;
+    try {
+        byteBuffer = toJavaByteBuffer(DirectBuffer(block->data, blockBytes));
+        jTrackPooledBuffer(byteBuffer, jlong(block->data), jlong(block->generation));
+        return byteBuffer;
+    } catch (...) {
+        if (byteBuffer != nullptr) {
+            env()->DeleteLocalRef(byteBuffer);
+        }
+        releasePooledBlock(block->data, block->generation);
+        throw;
+    }
+}
+
+void DirectBufferPool::release(const DirectBuffer& block) {
+    [[maybe_unused]] bool released = releasePooledBlock(block.data());
+    assertm(released, "DirectBufferPool::release of a block that isn't in use");
+}
+
+void DirectBufferPool::release(jobject byteBuffer) {
+    release(fromJavaByteBuffer(byteBuffer));
+}
+
+BufferPoolStats DirectBufferPool::stats() const {
+    std::lock_guard<std::mutex> lock(poolMutex());
+    return BufferPoolStats{slabs.size() * blocksPerSlab, inUse, peakInUse, slabs.size()};
+}
+
+bool releasePooledBlock(const void *address, uint64_t generation) {
+    auto *byte = static_cast<const std::byte *>(address);
+    std::lock_guard<std::mutex> lock(poolMutex());
+
+    auto& slabs = DirectBufferPool::slabsByAddress();
+    auto it = slabs.upper_bound(byte);
+    if (it == slabs.begin()) {
+        return false;
+    }
+    DirectBufferPool::Slab *slab = std::prev(it)->second;
+    DirectBufferPool *pool = slab->pool;
+    // Only the start of a block releases it, not an address inside one (of a slice, for example)
+    auto offset = size_t(byte - slab->memory);
+    size_t index = offset / pool->blockStride;
+    if (offset % pool->blockStride != 0 || index >= slab->blocks.size()) {
+        return false;
+    }
+
+    DirectBufferPool::Block& block = slab->blocks[index];
+    if (block.generation == 0 || (generation != 0 && generation != block.generation)) {
+        return false;
+    }
+    block.generation = 0;
+    pool->freeBlocks.push_back(&block);
+    --pool->inUse;
+    return true;
+}
+
+} // namespace jni_pp
@@ -9,20 +9,23 @@
 // This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
 //
 
+#include <memory>
+
 #include "jnipp/Converters.hpp"
+#include "jnipp/Utf.hpp"
 
 namespace jni_pp {
 
 jvalue convertToJValue(const std::string& arg) {
     jvalue jv;
-    jv.l = env()->NewStringUTF(arg.c_str());
+    jv.l = toJString(arg.data(), arg.size());
     return jv;
 }
 
 jvalue convertToJValue(const char * arg) {
     jvalue jv;
     if (!arg) jv.l = nullptr;
-    else jv.l = env()->NewStringUTF(arg);
+    else jv.l = toJString(arg, strlen(arg));
     return jv;
 }
 
@@ -95,4 +98,176 @@ jstring toJString(const std::string& s) {
     return jstring(convertToJValue(s).l);
 }
 
-}
\ No newline at end of file
+static_assert(sizeof(jchar) == sizeof(char16_t), "jchar and char16_t must both be UTF-16 code units");
+
+// Strings up to this many code units are converted through a buffer on the stack
+static constexpr size_t kStackStringUnits = 256;
+
+// Longer ones use a buffer kept per thread, up to this many code units, and a temporary one beyond that
+static constexpr size_t kMaxThreadStringUnits = 64 * 1024;
+
+static char16_t *threadStringBuffer(size_t units) {
+    thread_local std::unique_ptr<char16_t[]> buffer;
+    thread_local size_t capacity = 0;
+    if (capacity < units) {
+        buffer.reset(new char16_t[units]);
+        capacity = units;
+    }
+    return buffer.get();
+}
+
+//
+// ASCII is by far the most common case.  It is checked for up front (in blocks, see Utf.hpp) and then just widened,
+// without decoding.  NewString from UTF-16 avoids the validation and decoding of modified UTF-8 that NewStringUTF
+// does in the JVM, and a JVM with compact strings still stores the result as Latin-1.
+//
+jstring toJString(const char *s, size_t length) {
+    size_t maxUnits = maxUtf16Length(length);
+    char16_t stackBuffer[kStackStringUnits];
+    std::unique_ptr<char16_t[]> temporaryBuffer;
+    char16_t *buffer;
+    if (maxUnits <= kStackStringUnits) {
+        buffer = stackBuffer;
+    } else if (maxUnits <= kMaxThreadStringUnits) {
+        buffer = threadStringBuffer(maxUnits);
+    } else {
+        temporaryBuffer.reset(new char16_t[maxUnits]);
+        buffer = temporaryBuffer.get();
+    }
+
+    size_t units;
+    if (isAscii(s, length)) {
+        asciiToUtf16(s, length, buffer);
+        units = length;
+    } else {
+        units = utf8ToUtf16(s, length, buffer);
+    }
+    return env()->NewString(reinterpret_cast<const jchar *>(buffer), jsize(units));
+}
+
+jstring toJString(std::string_view s) {
+    return toJString(s.data(), s.size());
+}
+
+// Already UTF-16, nothing to transcode
+jstring toJString(std::u16string_view s) {
+    return env()->NewString(reinterpret_cast<const jchar *>(s.data()), jsize(s.size()));
+}
+
+namespace {
+
+// Holds the contents of a string with GetStringCritical, and releases them even if the code using them throws
+class StringCritical {
+public:
+    explicit StringCritical(jstring s) : jniEnv(env()), s(s), chars(jniEnv->GetStringCritical(s, nullptr)) {}
+    StringCritical(const StringCritical&) = delete;
+    StringCritical& operator=(const StringCritical&) = delete;
+    ~StringCritical() {
+        if (chars) {
+            jniEnv->ReleaseStringCritical(s, chars);
+        }
+    }
+
+    const char16_t *data() const { return reinterpret_cast<const char16_t *>(chars); }
+
+private:
+    JNIEnv *jniEnv;
+    jstring s;
+    const jchar *chars;
+};
+
+} // namespace
+
+//
+// Call convert with the UTF-16 contents of s, which is length code units long.  Short strings are copied to the stack
+// with GetStringRegion, long ones are used in place with GetStringCritical, so convert must not make any JNI calls or
+// allocate.  Returns false, without calling convert, if the contents aren't available (OutOfMemoryError is pending).
+//
+template<typename Convert>
+static bool withStringChars(jstring s, size_t length, Convert&& convert) {
+    if (length <= kStackStringUnits) {
+        char16_t buffer[kStackStringUnits];
+        env()->GetStringRegion(s, 0, jsize(length), reinterpret_cast<jchar *>(buffer));
+        convert(static_cast<const char16_t *>(buffer), length);
+        return true;
+    }
+    StringCritical chars(s);
+    if (chars.data() == nullptr) {
+        return false;
+    }
+    convert(chars.data(), length);
+    return true;
+}
+
+//
+// Size out exactly once (keeping its capacity) and transcode into it.  Long strings are measured in one critical
+// region and transcoded in a second, so out is resized, which may allocate or throw, with the GC free to run.
+//
+template<typename String>
+static void assignJString(jstring s, String& out) {
+    if (s == nullptr) {
+        out.clear();
+        return;
+    }
+    auto length = size_t(env()->GetStringLength(s));
+    if (length <= kStackStringUnits) {
+        char16_t buffer[kStackStringUnits];
+        env()->GetStringRegion(s, 0, jsize(length), reinterpret_cast<jchar *>(buffer));
+        out.resize(utf8Length(buffer, length));
+        utf16ToUtf8(buffer, length, out.data());
+        return;
+    }
+    size_t size = 0;
+    if (!withStringChars(s, length, [&size](const char16_t *utf16, size_t units) {
+            size = utf8Length(utf16, units);
+        })) {
+        out.clear();
+        return;
+    }
+    out.resize(size);
+    if (!withStringChars(s, length, [&out](const char16_t *utf16, size_t units) {
+            utf16ToUtf8(utf16, units, out.data());
+        })) {
+        out.clear();
+    }
+}
+
+std::string jStringToString(jstring s) {
+    std::string result;
+    assignJString(s, result);
+    return result;
+}
+
+void jStringToString(jstring s, std::string& out) {
+    assignJString(s, out);
+}
+
+void jStringToString(jstring s, std::pmr::string& out) {
+    assignJString(s, out);
+}
+
+size_t jStringToBuffer(jstring s, char *buffer, size_t size) {
+    size_t needed = 0;
+    bool written = false;
+    if (s != nullptr) {
+        withStringChars(s, size_t(env()->GetStringLength(s)), [&](const char16_t *utf16, size_t length) {
+            needed = utf8Length(utf16, length);
+            if (needed < size) {
+                utf16ToUtf8(utf16, length, buffer);
+                buffer[needed] = '\0';
+                written = true;
+            }
+        });
+    }
+    if (!written && size > 0) {
+        buffer[0] = '\0';
+    }
+    return needed;
+}
+
+char * jStringToCharPtr(jstring s) {
+    if (s == nullptr) return nullptr;
+    return strdup(jStringToString(s).c_str());
+}
+
+}
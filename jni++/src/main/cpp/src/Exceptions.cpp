@@ -11,6 +11,7 @@
 
 #include "jnipp/Exceptions.hpp"
 #include "jnipp/Utilities.hpp"
+#include "jnipp/References.hpp"
 
 namespace jni_pp {
 
@@ -19,6 +20,10 @@ void checkForExceptions() {
         jthrowable jexception = env()->ExceptionOccurred();
         env()->ExceptionClear();
 
+        // Calls that don't need a local frame (see NeedsLocalFrame) rely on this one to clean up the references created
+        // while collecting the exception details.
+        JniLocalReferenceScope refs;
+
         java_exception_details details(jexception);
 
         jni_pp::log_print(LOG_ERROR, "Caught JAVA exception %s: %s", details.name.c_str(), details.message.c_str());
@@ -40,9 +45,10 @@ void checkForExceptions() {
             jni_pp::log_print(LOG_ERROR, "Attempt to send Java exception found in native caller threw exception.");
         }
 
-        // Going to intentionally leak this since we are shutting down anyway and I'm not 100% sure crashlytics doesn't move this onto another
-        // thread.
-        // env()->DeleteLocalRef(jexception);
+        // jexception was created before refs' frame was pushed (PushLocalFrame can't be called with an exception
+        // pending) so it isn't covered by it.  Calls without a frame of their own would otherwise leak it on every
+        // exception, which adds up in native loops that catch and retry.
+        env()->DeleteLocalRef(jexception);
 
         throw java_exception(details);
     }
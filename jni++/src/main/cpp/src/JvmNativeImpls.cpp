@@ -14,6 +14,7 @@
 #include "jnipp/Singletons.hpp"
 #include "jnipp/Converters.hpp"
 #include "jnipp/ThreadWrapper.hpp"
+#include "jnipp/Buffers.hpp"
 
 using namespace jni_pp;
 
@@ -58,6 +59,19 @@ void Java_dev_tmich_jnipp_JavaToNativeExporter_nativeLog(JNIEnv *env, jclass cla
     jni_pp::log_print(level, msg.c_str());
 }
 
+extern "C"
+void Java_dev_tmich_jnipp_JavaToNativeExporter_releasePooledBuffer(JNIEnv *env, jclass clazz, jobject buffer) {
+    void *address = buffer != nullptr ? env->GetDirectBufferAddress(buffer) : nullptr;
+    if (address != nullptr) {
+        releasePooledBlock(address);
+    }
+}
+
+extern "C"
+void Java_dev_tmich_jnipp_JavaToNativeExporter_releasePooledBlock(JNIEnv *env, jclass clazz, jlong address, jlong generation) {
+    releasePooledBlock(reinterpret_cast<const void *>(address), uint64_t(generation));
+}
+
 extern "C"
 jint Java_dev_tmich_jnipp_JavaToNativeExporter_nativeThreadWrapper(JNIEnv *env, jclass cls, jlong ptrToJavaThreadArgs)
 {
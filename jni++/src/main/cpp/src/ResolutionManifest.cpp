@@ -0,0 +1,260 @@
+//
+// ResolutionManifest.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "jnipp/ResolutionManifest.hpp"
+#include "JniPlusPlus.hpp"
+#include "jnipp/JniMapping.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace jni_pp {
+
+StaticMethod<long, std::string> jClassFingerprint("dev.tmich.jnipp.JavaToNativeExporter", "classFingerprint");
+StaticMethod<std::string, JvmObject<"java.lang.reflect.AccessibleObject">> jMemberDescriptor("dev.tmich.jnipp.JavaToNativeExporter",
+                                                                                         "memberDescriptor");
+
+static const char *kManifestHeader = "# jni++ resolution manifest v1";
+
+struct ManifestEntry {
+    long fingerprint;
+    std::string descriptor;
+};
+
+struct ResolutionManifest {
+    std::mutex mutex;
+    std::string path;
+    std::unordered_map<std::string, ManifestEntry> entries;    // Keyed by makeKey()
+    std::unordered_map<std::string, long> fingerprints;         // Class name to fingerprint, computed once per run
+
+    std::atomic<bool> enabled{false};
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> stale{0};
+    std::atomic<size_t> recorded{0};
+};
+
+static ResolutionManifest& manifest() {
+    static auto *instance = new ResolutionManifest();
+    return *instance;
+}
+
+//
+// Entries are written one per line as tab separated fields.  The first five make up the key.
+//
+//   kind  className  memberName  numParameters  requestedSignature  fingerprint  descriptor
+//
+static std::string makeKey(ManifestMemberKind kind, std::string_view className, std::string_view memberName,
+                           int numParameters, std::string_view requestedSignature) {
+    std::string key;
+    key.reserve(className.size() + memberName.size() + requestedSignature.size() + 16);
+    key.append(std::to_string(int(kind))).append(1, '\t')
+       .append(className).append(1, '\t')
+       .append(memberName).append(1, '\t')
+       .append(std::to_string(numParameters)).append(1, '\t')
+       .append(requestedSignature);
+    return key;
+}
+
+static std::string makeKey(const ManifestMember& member) {
+    return makeKey(member.kind, member.className, member.memberName, member.numParameters, member.requestedSignature);
+}
+
+static std::vector<std::string> splitFields(const std::string& line) {
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream stream(line);
+    while (std::getline(stream, field, '\t')) {
+        fields.push_back(field);
+    }
+    // getline drops an empty trailing field
+    if (!line.empty() && line.back() == '\t') {
+        fields.emplace_back();
+    }
+    return fields;
+}
+
+static bool loadManifest(const std::string& path, std::unordered_map<std::string, ManifestEntry>& entries) {
+    std::ifstream in(path);
+    if (!in) {
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(in, line) || line != kManifestHeader) {
+        getLogger()->warning("Ignoring resolution manifest with unknown format: " + path);
+        return false;
+    }
+
+    while (std::getline(in, line)) {
+        auto fields = splitFields(line);
+        if (fields.size() != 7) {
+            continue;
+        }
+        try {
+            auto kind = ManifestMemberKind(std::stoi(fields[0]));
+            auto key = makeKey(kind, fields[1], fields[2], std::stoi(fields[3]), fields[4]);
+            entries[key] = ManifestEntry{std::stol(fields[5]), fields[6]};
+        } catch (const std::exception&) {
+            // Skip malformed lines, the member will just be looked up reflectively
+        }
+    }
+    return true;
+}
+
+//
+// Fingerprint of the class file of className and its superclasses.  0 if it can't be computed, in which case the
+// class is never recorded.
+//
+static long classFingerprint(const std::string& className) {
+    auto& m = manifest();
+    {
+        std::lock_guard<std::mutex> lock(m.mutex);
+        auto found = m.fingerprints.find(className);
+        if (found != m.fingerprints.end()) {
+            return found->second;
+        }
+    }
+
+    long fingerprint = jClassFingerprint(className);
+
+    std::lock_guard<std::mutex> lock(m.mutex);
+    m.fingerprints.emplace(className, fingerprint);
+    return fingerprint;
+}
+
+void setResolutionManifest(const std::string& path) {
+    auto& m = manifest();
+    std::unordered_map<std::string, ManifestEntry> loaded;
+    if (!path.empty() && loadManifest(path, loaded)) {
+        log_print(LOG_DEBUG, "Loaded %zu entries from resolution manifest %s", loaded.size(), path.c_str());
+    }
+
+    std::lock_guard<std::mutex> lock(m.mutex);
+    m.path = path;
+    m.entries = std::move(loaded);
+    m.enabled = !path.empty();
+}
+
+const std::string& getResolutionManifest() {
+    return manifest().path;
+}
+
+bool saveResolutionManifest() {
+    auto& m = manifest();
+    std::lock_guard<std::mutex> lock(m.mutex);
+    if (m.path.empty()) {
+        return false;
+    }
+
+    // Write to a temporary file and rename it over the manifest so a crash never leaves a partial one behind
+    std::string tempPath = m.path + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::trunc);
+        if (!out) {
+            getLogger()->error("Could not write resolution manifest: " + tempPath);
+            return false;
+        }
+        out << kManifestHeader << '\n';
+        for (auto& [key, entry] : m.entries) {
+            out << key << '\t' << entry.fingerprint << '\t' << entry.descriptor << '\n';
+        }
+        if (!out.flush()) {
+            getLogger()->error("Could not write resolution manifest: " + tempPath);
+            return false;
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), m.path.c_str()) != 0) {
+        getLogger()->error("Could not replace resolution manifest: " + m.path);
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+ResolutionManifestStats getResolutionManifestStats() {
+    auto& m = manifest();
+    std::lock_guard<std::mutex> lock(m.mutex);
+    return ResolutionManifestStats{m.entries.size(), m.hits, m.stale, m.recorded};
+}
+
+bool isResolutionManifestEnabled() {
+    return manifest().enabled;
+}
+
+bool hasManifestDescriptor(const ManifestMember& member) {
+    auto& m = manifest();
+    if (!m.enabled) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m.mutex);
+    return m.entries.find(makeKey(member)) != m.entries.end();
+}
+
+std::optional<std::string> findManifestDescriptor(const ManifestMember& member) {
+    auto& m = manifest();
+    if (!m.enabled) {
+        return std::nullopt;
+    }
+
+    auto key = makeKey(member);
+    ManifestEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(m.mutex);
+        auto found = m.entries.find(key);
+        if (found == m.entries.end()) {
+            return std::nullopt;
+        }
+        entry = found->second;
+    }
+
+    long fingerprint = classFingerprint(member.className);
+    if (fingerprint == 0 || fingerprint != entry.fingerprint) {
+        log_print(LOG_DEBUG, "Resolution manifest entry for %s.%s is stale", member.className.c_str(), member.memberName.c_str());
+        discardManifestDescriptor(member);
+        return std::nullopt;
+    }
+
+    m.hits++;
+    return entry.descriptor;
+}
+
+void discardManifestDescriptor(const ManifestMember& member) {
+    auto& m = manifest();
+    std::lock_guard<std::mutex> lock(m.mutex);
+    if (m.entries.erase(makeKey(member)) > 0) {
+        m.stale++;
+    }
+}
+
+void recordManifestDescriptor(const ManifestMember& member, jobject reflectedMember) {
+    auto& m = manifest();
+    if (!m.enabled) {
+        return;
+    }
+
+    long fingerprint = classFingerprint(member.className);
+    if (fingerprint == 0) {
+        return;
+    }
+
+    std::string descriptor = jMemberDescriptor(reflectedMember);
+
+    std::lock_guard<std::mutex> lock(m.mutex);
+    m.entries[makeKey(member)] = ManifestEntry{fingerprint, std::move(descriptor)};
+    m.recorded++;
+}
+
+} // namespace jni_pp
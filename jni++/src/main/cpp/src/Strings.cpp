@@ -0,0 +1,387 @@
+//
+// Strings.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "jnipp/Strings.hpp"
+#include "JniPlusPlus.hpp"
+#include "jnipp/ConcurrentCache.hpp"
+#include "jnipp/Utf.hpp"
+#include "jnipp/Utilities.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace jni_pp {
+
+InternedJString::InternedJString(std::string value) : value(std::move(value)) {
+    registerBinding(this);
+}
+
+InternedJString::~InternedJString() {
+    unregisterBinding(this);
+    // Often static, so only clean up if the VM is still around.  Otherwise env() would wait for one.
+    if (javaString && isEnvSetup()) {
+        try {
+            env()->DeleteGlobalRef(javaString);
+        } catch (...) {} // Best effort, ignore errors
+    }
+}
+
+jstring InternedJString::get() const {
+    call_once(runOnce, [&] {
+        jstring localString = toJString(value);
+        assertm(localString, "Failed to create Java string");
+        javaString = static_cast<jstring>(env()->NewGlobalRef(localString));
+        env()->DeleteLocalRef(localString);
+    });
+    return javaString;
+}
+
+//
+// Cache keys are the UTF-16 contents.  Lookups use a view of the stack copy, entries own theirs.
+//
+struct DedupLookupKey {
+    std::u16string_view units;
+    size_t precomputedHash;
+
+    DedupLookupKey(const char16_t *units, size_t length) : units(units, length),
+            precomputedHash(KeyHasher().add(std::string_view(reinterpret_cast<const char *>(units), length * sizeof(char16_t))).value()) {}
+
+    size_t hash() const { return precomputedHash; }
+};
+
+struct DedupKey {
+    std::u16string units;
+    size_t precomputedHash;
+
+    explicit DedupKey(const DedupLookupKey& key) : units(key.units), precomputedHash(key.precomputedHash) {}
+
+    size_t hash() const { return precomputedHash; }
+    bool operator==(const DedupKey& other) const { return units == other.units; }
+    bool operator==(const DedupLookupKey& other) const { return units == other.units; }
+};
+
+typedef ConcurrentCache<DedupKey, SharedString> DedupCache;
+
+static constexpr size_t kDefaultStringCacheCapacity = 4096;
+
+static DedupCache& dedupCache() {
+    static auto *instance = new DedupCache();
+    return *instance;
+}
+
+static std::atomic<size_t> maxShardEntries{kDefaultStringCacheCapacity / DedupCache::numShards()};
+static std::atomic<size_t> dedupHits{0};
+static std::atomic<size_t> dedupMisses{0};
+static std::atomic<size_t> dedupUncached{0};
+
+SharedString dedupJString(jstring s) {
+    if (s == nullptr) {
+        return nullptr;
+    }
+
+    auto length = size_t(env()->GetStringLength(s));
+    if (length > kMaxDedupUnits) {
+        dedupUncached.fetch_add(1, std::memory_order_relaxed);
+        return std::make_shared<const std::string>(jStringToString(s));
+    }
+
+    char16_t buffer[kMaxDedupUnits];
+    env()->GetStringRegion(s, 0, jsize(length), reinterpret_cast<jchar *>(buffer));
+    DedupLookupKey key(buffer, length);
+    if (auto found = dedupCache().find(key)) {
+        dedupHits.fetch_add(1, std::memory_order_relaxed);
+        return *found;
+    }
+
+    dedupMisses.fetch_add(1, std::memory_order_relaxed);
+    std::string utf8;
+    utf16ToUtf8(buffer, length, utf8);
+    auto value = std::make_shared<const std::string>(std::move(utf8));
+    return dedupCache().findOrInsertBounded(key, [&value] { return value; }, maxShardEntries.load(std::memory_order_relaxed));
+}
+
+void setStringCacheCapacity(size_t entries) {
+    maxShardEntries = std::max<size_t>(1, entries / DedupCache::numShards());
+}
+
+void clearStringCache() {
+    dedupCache().clear();
+}
+
+StringCacheStats getStringCacheStats() {
+    return StringCacheStats{dedupCache().size(), dedupHits, dedupMisses, dedupUncached};
+}
+
+StaticMethod<jobject, jobjectArray> jPackStrings("dev.tmich.jnipp.JavaToNativeExporter", "packStrings", "([Ljava/lang/String;)[B");
+StaticMethod<jobject, jobject, int> jUnpackStrings("dev.tmich.jnipp.JavaToNativeExporter", "unpackStrings", "([BI)[Ljava/lang/String;");
+
+// Packed arrays at least this big, with at least this many strings, are unpacked on several threads
+static constexpr size_t kParallelUnpackBytes = 1024 * 1024;
+static constexpr size_t kParallelUnpackStrings = 1024;
+static constexpr size_t kMaxUnpackThreads = 8;
+
+static int32_t readPackedLength(const char *bytes) {
+    int32_t length;
+    memcpy(&length, bytes, sizeof(length));
+    return length;
+}
+
+// Unpack count strings, starting at bytes, into strings
+static void unpackStrings(const char *bytes, std::string *strings, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        int32_t length = readPackedLength(bytes);
+        bytes += sizeof(int32_t);
+        if (length > 0) {
+            strings[i].assign(bytes, size_t(length));
+            bytes += length;
+        }
+    }
+}
+
+namespace {
+
+// Joins the unpacking threads however the unpack is left, so an exception starting one never leaves the rest running
+struct JoinThreads {
+    std::vector<std::thread>& threads;
+    ~JoinThreads() {
+        for (auto& thread : threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+};
+
+} // namespace
+
+std::vector<std::string> jStringArrayToVector(jobjectArray array) {
+    std::vector<std::string> strings;
+    if (array == nullptr) {
+        return strings;
+    }
+    auto count = size_t(env()->GetArrayLength(array));
+    if (count == 0) {
+        return strings;
+    }
+
+    //
+    // The packed bytes are copied out with one region copy rather than unpacked in place from a critical region.
+    // Unpacking a large array (and starting threads to do it) takes far too long to hold off the GC for.
+    //
+    std::unique_ptr<char[]> bytes;
+    size_t size;
+    {
+        JniLocalReferenceScope refs(4);
+        auto packed = static_cast<jbyteArray>(jPackStrings(array));
+        size = size_t(env()->GetArrayLength(packed));
+        bytes.reset(new char[size]);
+        env()->GetByteArrayRegion(packed, 0, jsize(size), reinterpret_cast<jbyte *>(bytes.get()));
+    }
+    strings.resize(count);
+
+    size_t threads = std::min<size_t>({kMaxUnpackThreads, std::max(1u, std::thread::hardware_concurrency()), count});
+    if (size < kParallelUnpackBytes || count < kParallelUnpackStrings || threads < 2) {
+        unpackStrings(bytes.get(), strings.data(), count);
+    } else {
+        // One pass over just the length prefixes to find where each thread's share starts
+        size_t perThread = (count + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        JoinThreads joinWorkers{workers};
+        const char *cursor = bytes.get();
+        const char *start = bytes.get();
+        size_t first = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (i > first && i % perThread == 0) {
+                workers.emplace_back(unpackStrings, start, strings.data() + first, i - first);
+                start = cursor;
+                first = i;
+            }
+            cursor += sizeof(int32_t) + size_t(std::max(readPackedLength(cursor), int32_t(0)));
+        }
+        unpackStrings(start, strings.data() + first, count - first);
+    }
+    return strings;
+}
+
+jobjectArray vectorToJStringArray(const std::vector<std::string>& strings) {
+    size_t size = sizeof(int32_t) * strings.size();
+    for (const auto& s : strings) {
+        size += s.size();
+    }
+    if (size > size_t(INT32_MAX)) {
+        throw std::length_error("Strings too large to pack into one Java array");
+    }
+
+    // Packed natively and copied in with one region copy, see jStringArrayToVector
+    std::unique_ptr<char[]> bytes(new char[size]);
+    char *out = bytes.get();
+    for (const auto& s : strings) {
+        auto length = int32_t(s.size());
+        memcpy(out, &length, sizeof(length));
+        memcpy(out + sizeof(length), s.data(), s.size());
+        out += sizeof(length) + s.size();
+    }
+
+    JniLocalReferenceScope refs(4);
+    jbyteArray packed = env()->NewByteArray(jsize(size));
+    if (packed == nullptr) {
+        return nullptr;  // Out of memory, OutOfMemoryError is pending
+    }
+    env()->SetByteArrayRegion(packed, 0, jsize(size), reinterpret_cast<const jbyte *>(bytes.get()));
+    bytes.reset();
+
+    jobject array = jUnpackStrings(packed, int(strings.size()));
+    return static_cast<jobjectArray>(refs.releaseLocalRefs(array));
+}
+
+size_t streamJString(jstring s, const StringChunkSink& sink, size_t chunkUnits) {
+    if (s == nullptr) {
+        return 0;
+    }
+    assertm(chunkUnits >= 2, "Chunks must have room for a surrogate pair");
+
+    auto length = size_t(env()->GetStringLength(s));
+    std::unique_ptr<char16_t[]> utf16(new char16_t[std::min(chunkUnits, length)]);
+    std::unique_ptr<char[]> utf8(new char[maxUtf8Length(std::min(chunkUnits, length))]);
+
+    size_t streamed = 0;
+    size_t start = 0;
+    while (start < length) {
+        size_t units = std::min(chunkUnits, length - start);
+        env()->GetStringRegion(s, jsize(start), jsize(units), reinterpret_cast<jchar *>(utf16.get()));
+        // Leave a trailing high surrogate for the next chunk so the pair is converted together
+        if (start + units < length && units > 1 && utf16[units - 1] >= 0xD800 && utf16[units - 1] <= 0xDBFF) {
+            --units;
+        }
+        size_t bytes = utf16ToUtf8(utf16.get(), units, utf8.get());
+        streamed += bytes;
+        start += units;
+        if (!sink(std::string_view(utf8.get(), bytes))) {
+            break;
+        }
+    }
+    return streamed;
+}
+
+size_t streamJString(jstring s, std::ostream& out, size_t chunkUnits) {
+    return streamJString(s, [&out](std::string_view chunk) {
+        out.write(chunk.data(), std::streamsize(chunk.size()));
+        return bool(out);
+    }, chunkUnits);
+}
+
+JavaString::JavaString(JavaString&& other) noexcept :
+        javaString(other.javaString), globalRef(other.globalRef), converted(std::move(other.converted)) {
+    other.javaString = nullptr;
+    other.converted.reset();
+}
+
+JavaString& JavaString::operator=(JavaString&& other) noexcept {
+    // other releases what this held when it is destroyed
+    std::swap(javaString, other.javaString);
+    std::swap(globalRef, other.globalRef);
+    std::swap(converted, other.converted);
+    return *this;
+}
+
+JavaString::~JavaString() {
+    if (javaString && isEnvSetup()) {
+        if (globalRef) {
+            env()->DeleteGlobalRef(javaString);
+        } else {
+            env()->DeleteLocalRef(javaString);
+        }
+    }
+    javaString = nullptr;
+}
+
+jstring JavaString::release() {
+    jstring released = javaString;
+    javaString = nullptr;
+    converted.reset();
+    return released;
+}
+
+JavaString JavaString::global() const {
+    if (!javaString) {
+        return JavaString();
+    }
+    return JavaString(static_cast<jstring>(env()->NewGlobalRef(javaString)), true);
+}
+
+size_t JavaString::length() const {
+    return javaString ? size_t(env()->GetStringLength(javaString)) : 0;
+}
+
+const std::string& JavaString::utf8() const {
+    if (!converted) {
+        converted = jStringToString(javaString);
+    }
+    return *converted;
+}
+
+bool JavaString::equals(std::string_view utf8) const {
+    if (!javaString) {
+        return false;
+    }
+    if (converted) {
+        return *converted == utf8;
+    }
+    size_t units = length();
+    // Each code unit is at least one byte, at most three, so most mismatches don't need the contents at all
+    if (utf8.size() < units || utf8.size() > maxUtf8Length(units)) {
+        return false;
+    }
+    // With the length already taken, rather than utf16_view() taking it again
+    Utf16View view(javaString, units);
+    return view.data() && utf16EqualsUtf8(view.data(), view.size(), utf8.data(), utf8.size());
+}
+
+size_t JavaString::stream(const StringChunkSink& sink, size_t chunkUnits) const {
+    return streamJString(javaString, sink, chunkUnits);
+}
+
+size_t JavaString::stream(std::ostream& out, size_t chunkUnits) const {
+    return streamJString(javaString, out, chunkUnits);
+}
+
+// The length is taken before the contents are pinned, since no JNI calls may be made after, and kept with them
+JavaString::Utf16View JavaString::utf16_view() const {
+    return Utf16View(javaString, length());
+}
+
+JavaString::Utf16View::Utf16View(jstring javaString, size_t length) : javaString(javaString), length(length) {
+    if (javaString) {
+        chars = reinterpret_cast<const char16_t *>(env()->GetStringCritical(javaString, nullptr));
+        if (!chars) {
+            this->length = 0;   // Out of memory, OutOfMemoryError is pending
+        }
+    }
+}
+
+JavaString::Utf16View::Utf16View(Utf16View&& other) noexcept :
+        javaString(other.javaString), chars(other.chars), length(other.length) {
+    other.chars = nullptr;
+}
+
+JavaString::Utf16View::~Utf16View() {
+    if (chars) {
+        env()->ReleaseStringCritical(javaString, reinterpret_cast<const jchar *>(chars));
+    }
+}
+
+} // namespace jni_pp
@@ -0,0 +1,327 @@
+//
+// Utf.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "jnipp/Utf.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define JNIPP_UTF_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define JNIPP_UTF_NEON
+#endif
+
+namespace jni_pp {
+
+static constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+static inline bool isHighSurrogate(char16_t c) { return c >= 0xD800 && c <= 0xDBFF; }
+static inline bool isLowSurrogate(char16_t c) { return c >= 0xDC00 && c <= 0xDFFF; }
+static inline bool isSurrogate(char16_t c) { return c >= 0xD800 && c <= 0xDFFF; }
+
+//
+// Number of leading code units, starting at utf16, that are ASCII.  Checks blocks at a time so may stop short of
+// the first non-ASCII unit, callers handle what's left one unit at a time.
+//
+static inline size_t asciiPrefix(const char16_t *utf16, size_t length) {
+    size_t i = 0;
+#if defined(JNIPP_UTF_SSE2)
+    const __m128i nonAscii = _mm_set1_epi16(int16_t(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= length; i += 8) {
+        __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, nonAscii), zero)) != 0xFFFF) {
+            break;
+        }
+    }
+#elif defined(JNIPP_UTF_NEON)
+    for (; i + 8 <= length; i += 8) {
+        if (vmaxvq_u16(vld1q_u16(reinterpret_cast<const uint16_t *>(utf16 + i))) >= 0x80) {
+            break;
+        }
+    }
+#endif
+    for (; i + 4 <= length; i += 4) {
+        uint64_t block;
+        memcpy(&block, utf16 + i, sizeof(block));
+        if (block & 0xFF80FF80FF80FF80ull) {
+            break;
+        }
+    }
+    return i;
+}
+
+//
+// Narrow count ASCII code units to bytes.
+//
+static inline void narrowAscii(const char16_t *utf16, size_t count, char *utf8) {
+    size_t i = 0;
+#if defined(JNIPP_UTF_SSE2)
+    for (; i + 16 <= count; i += 16) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i + 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(utf8 + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(JNIPP_UTF_NEON)
+    for (; i + 8 <= count; i += 8) {
+        vst1_u8(reinterpret_cast<uint8_t *>(utf8 + i), vmovn_u16(vld1q_u16(reinterpret_cast<const uint16_t *>(utf16 + i))));
+    }
+#endif
+    for (; i < count; ++i) {
+        utf8[i] = char(utf16[i]);
+    }
+}
+
+size_t utf8Length(const char16_t *utf16, size_t length) {
+    size_t bytes = 0;
+    size_t i = 0;
+    while (i < length) {
+        size_t ascii = asciiPrefix(utf16 + i, length - i);
+        bytes += ascii;
+        i += ascii;
+        if (i == length) {
+            break;
+        }
+
+        char16_t c = utf16[i++];
+        if (c < 0x80) {
+            bytes += 1;
+        } else if (c < 0x800) {
+            bytes += 2;
+        } else if (isHighSurrogate(c) && i < length && isLowSurrogate(utf16[i])) {
+            bytes += 4;
+            ++i;
+        } else {
+            bytes += 3;  // Including an unpaired surrogate, which becomes U+FFFD
+        }
+    }
+    return bytes;
+}
+
+size_t utf16ToUtf8(const char16_t *utf16, size_t length, char *utf8) {
+    char *out = utf8;
+    size_t i = 0;
+    while (i < length) {
+        size_t ascii = asciiPrefix(utf16 + i, length - i);
+        narrowAscii(utf16 + i, ascii, out);
+        out += ascii;
+        i += ascii;
+        if (i == length) {
+            break;
+        }
+
+        char32_t c = utf16[i++];
+        if (c < 0x80) {
+            *out++ = char(c);
+            continue;
+        }
+        if (c < 0x800) {
+            *out++ = char(0xC0 | (c >> 6));
+            *out++ = char(0x80 | (c & 0x3F));
+            continue;
+        }
+        if (isSurrogate(char16_t(c))) {
+            if (isHighSurrogate(char16_t(c)) && i < length && isLowSurrogate(utf16[i])) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (utf16[i++] - 0xDC00);
+                *out++ = char(0xF0 | (c >> 18));
+                *out++ = char(0x80 | ((c >> 12) & 0x3F));
+                *out++ = char(0x80 | ((c >> 6) & 0x3F));
+                *out++ = char(0x80 | (c & 0x3F));
+                continue;
+            }
+            c = kReplacementCharacter;
+        }
+        *out++ = char(0xE0 | (c >> 12));
+        *out++ = char(0x80 | ((c >> 6) & 0x3F));
+        *out++ = char(0x80 | (c & 0x3F));
+    }
+    return size_t(out - utf8);
+}
+
+void utf16ToUtf8(const char16_t *utf16, size_t length, std::string& out) {
+    out.resize(utf8Length(utf16, length));
+    utf16ToUtf8(utf16, length, out.data());
+}
+
+bool utf16EqualsUtf8(const char16_t *utf16, size_t utf16Length, const char *utf8, size_t utf8Length) {
+    // Every code unit is between one and three bytes (a surrogate pair is four for two)
+    if (utf8Length < utf16Length || utf8Length > maxUtf8Length(utf16Length)) {
+        return false;
+    }
+
+    constexpr size_t kBlockUnits = 64;
+    char block[maxUtf8Length(kBlockUnits)];
+    size_t i = 0;
+    size_t matched = 0;
+    while (i < utf16Length) {
+        size_t units = std::min(kBlockUnits, utf16Length - i);
+        // Don't split a surrogate pair across blocks
+        if (i + units < utf16Length && isHighSurrogate(utf16[i + units - 1]) && units > 1) {
+            --units;
+        }
+        size_t bytes = utf16ToUtf8(utf16 + i, units, block);
+        if (bytes > utf8Length - matched || memcmp(block, utf8 + matched, bytes) != 0) {
+            return false;
+        }
+        matched += bytes;
+        i += units;
+    }
+    return matched == utf8Length;
+}
+
+//
+// Number of leading bytes that are ASCII, checked in blocks like asciiPrefix.
+//
+static inline size_t asciiPrefix(const char *utf8, size_t length) {
+    size_t i = 0;
+#if defined(JNIPP_UTF_SSE2)
+    for (; i + 16 <= length; i += 16) {
+        if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8 + i))) != 0) {
+            break;
+        }
+    }
+#elif defined(JNIPP_UTF_NEON)
+    for (; i + 16 <= length; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(reinterpret_cast<const uint8_t *>(utf8 + i))) >= 0x80) {
+            break;
+        }
+    }
+#endif
+    for (; i + 8 <= length; i += 8) {
+        uint64_t block;
+        memcpy(&block, utf8 + i, sizeof(block));
+        if (block & 0x8080808080808080ull) {
+            break;
+        }
+    }
+    return i;
+}
+
+//
+// Widen count ASCII bytes to code units.
+//
+static inline void widenAscii(const char *utf8, size_t count, char16_t *utf16) {
+    size_t i = 0;
+#if defined(JNIPP_UTF_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8 + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(utf16 + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(utf16 + i + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+#elif defined(JNIPP_UTF_NEON)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t *>(utf8 + i));
+        vst1q_u16(reinterpret_cast<uint16_t *>(utf16 + i), vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(utf16 + i + 8), vmovl_u8(vget_high_u8(bytes)));
+    }
+#endif
+    for (; i < count; ++i) {
+        utf16[i] = char16_t(uint8_t(utf8[i]));
+    }
+}
+
+bool isAscii(const char *utf8, size_t length) {
+    size_t i = asciiPrefix(utf8, length);
+    for (; i < length; ++i) {
+        if (uint8_t(utf8[i]) >= 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void asciiToUtf16(const char *ascii, size_t length, char16_t *utf16) {
+    widenAscii(ascii, length, utf16);
+}
+
+static inline bool isContinuation(uint8_t byte) {
+    return (byte & 0xC0) == 0x80;
+}
+
+size_t utf8ToUtf16(const char *utf8, size_t length, char16_t *utf16) {
+    auto *in = reinterpret_cast<const uint8_t *>(utf8);
+    char16_t *out = utf16;
+    size_t i = 0;
+    while (i < length) {
+        size_t ascii = asciiPrefix(utf8 + i, length - i);
+        widenAscii(utf8 + i, ascii, out);
+        out += ascii;
+        i += ascii;
+        if (i == length) {
+            break;
+        }
+
+        uint8_t lead = in[i];
+        if (lead < 0x80) {
+            *out++ = lead;
+            ++i;
+            continue;
+        }
+
+        //
+        // Decode one multibyte sequence.  Anything malformed becomes U+FFFD and decoding resumes after the lead byte
+        // (or after the valid prefix of a truncated sequence).
+        //
+        char32_t c = kReplacementCharacter;
+        size_t consumed = 1;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            if (i + 1 < length && isContinuation(in[i + 1])) {
+                c = ((lead & 0x1F) << 6) | (in[i + 1] & 0x3F);
+                consumed = 2;
+            }
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            // Second byte range excludes overlong forms (E0) and encoded surrogates (ED)
+            uint8_t low = lead == 0xE0 ? 0xA0 : 0x80;
+            uint8_t high = lead == 0xED ? 0x9F : 0xBF;
+            if (i + 1 < length && in[i + 1] >= low && in[i + 1] <= high) {
+                if (i + 2 < length && isContinuation(in[i + 2])) {
+                    c = ((lead & 0x0F) << 12) | ((in[i + 1] & 0x3F) << 6) | (in[i + 2] & 0x3F);
+                    consumed = 3;
+                } else {
+                    consumed = 2;
+                }
+            }
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            // Second byte range excludes overlong forms (F0) and values above U+10FFFF (F4)
+            uint8_t low = lead == 0xF0 ? 0x90 : 0x80;
+            uint8_t high = lead == 0xF4 ? 0x8F : 0xBF;
+            if (i + 1 < length && in[i + 1] >= low && in[i + 1] <= high) {
+                if (i + 2 < length && isContinuation(in[i + 2])) {
+                    if (i + 3 < length && isContinuation(in[i + 3])) {
+                        c = ((lead & 0x07) << 18) | ((in[i + 1] & 0x3F) << 12) | ((in[i + 2] & 0x3F) << 6) | (in[i + 3] & 0x3F);
+                        consumed = 4;
+                    } else {
+                        consumed = 3;
+                    }
+                } else {
+                    consumed = 2;
+                }
+            }
+        }
+        i += consumed;
+
+        if (c >= 0x10000) {
+            c -= 0x10000;
+            *out++ = char16_t(0xD800 + (c >> 10));
+            *out++ = char16_t(0xDC00 + (c & 0x3FF));
+        } else {
+            *out++ = char16_t(c);
+        }
+    }
+    return size_t(out - utf16);
+}
+
+} // namespace jni_pp
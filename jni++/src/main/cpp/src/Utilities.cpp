@@ -11,13 +11,17 @@
 //
 
 #include <climits>
-#include <map>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 #include "JniPlusPlus.hpp"
 #include "jnipp/Utilities.hpp"
+#include "jnipp/ConcurrentCache.hpp"
 #include "jnipp/References.hpp"
 #include "jnipp/JniMapping.hpp"
+#include "jnipp/ResolutionManifest.hpp"
 
 #pragma GCC diagnostic ignored "-Wformat-security"
 
@@ -36,13 +40,19 @@ StaticMethod<JvmObject<"java.lang.reflect.AccessibleObject">, std::string, std::
 StaticMethod<JvmObject<"java.lang.reflect.Field">, std::string, std::string, bool> jLookupJavaField("dev.tmich.jnipp.JavaToNativeExporter",
                                                                        "lookupJavaField");
 InstanceMethod<JvmObject<"java.lang.Class">> jGetFieldClass("java/lang/reflect/Field", "getDeclaringClass");
+StaticMethod<jobject, jobject, jobject, jobject, jobject, jobject> jLookupJavaMembers("dev.tmich.jnipp.JavaToNativeExporter", "lookupJavaMembers",
+                                                                                   "([Ljava/lang/String;[Ljava/lang/String;[Z[I[Ljava/lang/reflect/AccessibleObject;)[[Ljava/lang/Object;");
 
 
 void setEnv(JNIEnv* env) {
 	envInstancePtr = env;
 }
 
-JNIEnv *env() {
+//
+// Slow path for env().  Only taken the first time a thread asks for its JNIEnv (or after it has been cleared) so
+// this is the only place that needs to synchronize.  Recursive because logging from here may end up calling env().
+//
+static JNIEnv *lookupEnvForCurrentThread() {
     std::lock_guard<std::recursive_mutex> lk(javaEnv_mutex);
 
 	if (!envInstancePtr) {
@@ -76,6 +86,18 @@ JNIEnv *env() {
 	return envInstancePtr;
 }
 
+//
+// envInstancePtr is thread_local so once it is set for this thread there is nothing shared to protect.  Return it
+// without taking any lock and only fall back to the synchronized lookup the first time.
+//
+JNIEnv *env() {
+    JNIEnv *cached = envInstancePtr;
+    if (cached) {
+        return cached;
+    }
+    return lookupEnvForCurrentThread();
+}
+
 bool isEnvSetup() {
     return (envInstancePtr != nullptr);
 }
@@ -149,6 +171,7 @@ bool createVM(jint version, const std::string& classPath)
 
 void destroyVM()
 {
+    waitForWarmup();
     std::lock_guard<std::mutex>  lock(javaVM_mutex);
     if (GlobalVM != nullptr) {
         GlobalVM->DestroyJavaVM();
@@ -206,6 +229,8 @@ void detachCurrentThread() {
   if (vm) {
     vm->DetachCurrentThread();
   }
+  // The cached env is only valid while attached.  Clear it so a later attach on this thread looks it up again.
+  setEnv(nullptr);
 }
 
 void initializeEnvironment() {
@@ -221,115 +246,233 @@ void initializeEnvironment() {
     jLookupJavaMember.getMethodInfo();
     jLookupJavaField.getMethodInfo();
     jGetFieldClass.getMethodInfo();
+    jLookupJavaMembers.getMethodInfo();
 
     //
     // Pass the current minimum log level to Java.  It might have been set before we created the VM or were attached.
     //
     setJavaMinimumLogLevel();
+
+    //
+    // Optionally resolve all the Methods, Fields, etc. constructed so far rather than waiting for their first use.
+    //
+    switch (getWarmupMode()) {
+        case WARMUP_IMMEDIATE:
+            warmup();
+            break;
+        case WARMUP_BACKGROUND:
+            warmupInBackground();
+            break;
+        case WARMUP_NONE:
+            break;
+    }
 }
 
-std::map<std::string, FieldInfo*> javaFieldCache;
-std::map<std::string, MethodInfo*> javaMethodCache;
-std::map<std::string, jclass> javaClassCache;
-std::recursive_mutex cacheMutex;
+//
+// Key for the class, method and field caches.  The hash is computed once, piecewise, when the key is made so lookups
+// (with MemberKeyView, which only holds views of the caller's strings) neither build nor rehash a string.  Classes
+// only use className.  Methods with a signature use it, otherwise the number of parameters (-1 when unused).
+//
+template <typename StringType>
+struct BasicMemberKey {
+    BasicMemberKey(StringType className, StringType memberName, StringType signature, int numParameters) :
+            className(className), memberName(memberName), signature(signature), numParameters(numParameters),
+            precomputedHash(KeyHasher().add(className).add(memberName).add(signature).add(numParameters).value()) {}
+
+    template <typename OtherStringType>
+    explicit BasicMemberKey(const BasicMemberKey<OtherStringType>& other) :
+            className(other.className), memberName(other.memberName), signature(other.signature),
+            numParameters(other.numParameters), precomputedHash(other.hash()) {}
+
+    size_t hash() const { return precomputedHash; }
+
+    template <typename OtherStringType>
+    bool operator==(const BasicMemberKey<OtherStringType>& other) const {
+        return precomputedHash == other.hash() && numParameters == other.numParameters &&
+               className == other.className && memberName == other.memberName && signature == other.signature;
+    }
+
+    StringType className;
+    StringType memberName;
+    StringType signature;
+    int numParameters;
+
+private:
+    size_t precomputedHash;
+};
+
+typedef BasicMemberKey<std::string> MemberKey;
+typedef BasicMemberKey<std::string_view> MemberKeyView;
+
+ConcurrentCache<MemberKey, FieldInfo*> javaFieldCache;
+ConcurrentCache<MemberKey, MethodInfo*> javaMethodCache;
+ConcurrentCache<MemberKey, jclass> javaClassCache;
+
+//
+// Resolution failures throw resolution_error rather than asserting, so that a stale binding is reported (and retried
+// on its next use) instead of aborting debug builds and caching a null ID in release builds.  Any pending Java
+// exception (NoClassDefFoundError, NoSuchMethodError, ...) is cleared first.
+//
+[[noreturn]] static void resolutionFailed(const std::string& message) {
+    if (env()->ExceptionCheck()) {
+        env()->ExceptionClear();
+    }
+    throw resolution_error(message);
+}
 
 //
 // Check the cache to find the class object.  If it isn't there use JNI to find it and store it in
 // the cache.
 //
 jclass getClass(const std::string &name) {
-    jclass cls = javaClassCache[name];
-    if (cls) {
-        return cls;
+    MemberKeyView key(name, {}, {}, -1);
+    if (auto cached = javaClassCache.find(key)) {
+        return *cached;
     }
 
     JniLocalReferenceScope  refs; // Clean up any local refs created in this method
 
-    cls = env()->FindClass(jni_pp::JvmClassNameToJniSignature(name, false).c_str());
-    assertm(cls != nullptr, "Class lookup failed");
+    jclass cls = env()->FindClass(jni_pp::JvmClassNameToJniSignature(name, false).c_str());
+    if (cls == nullptr) {
+        resolutionFailed("Class " + name + " not found");
+    }
 
     auto globalJClass = jclass(env()->NewGlobalRef(cls));
 
-    javaClassCache[name] = globalJClass;
+    // Another thread may have cached it while we were looking it up.  Keep theirs and drop ours.
+    jclass cachedJClass = javaClassCache.findOrInsert(key, [&] { return globalJClass; });
+    if (cachedJClass != globalJClass) {
+        env()->DeleteGlobalRef(globalJClass);
+    }
 
-    return globalJClass;
+    return cachedJClass;
 }
 
 
+//
+// Add a resolved method or field to its cache.  If another thread got there first, its entry is kept and returned.
+//
+static MethodInfo *cacheMethodInfo(const MemberKeyView& key, jclass class_, jmethodID methodID) {
+    return javaMethodCache.findOrInsert(key, [&] { return new MethodInfo{class_, methodID}; });
+}
+
+//
+// If a static field is in a superclass, accessing it through the base class jclass seems to cause an exception, so
+// fields are cached with the class that declares them (Field.getDeclaringClass) rather than the one named.
+//
+static FieldInfo *cacheFieldInfo(const MemberKeyView& key, jclass fieldClass, jfieldID fieldID) {
+    if (fieldClass == nullptr) {
+        resolutionFailed("Field.getDeclaringClass failed");
+    }
+    auto declaringClass = (jclass) env()->NewGlobalRef(fieldClass);
+
+    bool inserted = false;
+    FieldInfo *fi = javaFieldCache.findOrInsert(key, [&] {
+        inserted = true;
+        return new FieldInfo{declaringClass, fieldID};
+    });
+    if (!inserted) {
+        // Lost a race with another thread looking up the same field
+        env()->DeleteGlobalRef(declaringClass);
+    }
+    return fi;
+}
+
 //
 // get the MethodInfo for this Method (InstanceMethod, StaticMethod, or Constructor)
 //
-MethodInfo  *getMethodInfo(const std::string& className, const std::string& methodName, const std::string& signature, bool isStatic, int numParameters) {
+// The lookup itself is done without holding any cache lock (it may call back into Java through other cached Methods).
+// If two threads race to look up the same method, both resolve it and the first one to insert wins.  Nothing is
+// leaked since the class reference belongs to the class cache.
+//
+MethodInfo  *getMethodInfo(const std::string& className, const std::string& methodName, std::string_view signatureView, bool isStatic, int numParameters) {
+    MemberKeyView key(className, methodName, signatureView, signatureView.empty() ? numParameters : -1);
+    if (auto cached = javaMethodCache.find(key)) {
+        return *cached;
+    }
+
     JniLocalReferenceScope refs;  // Cleans up any local references created in this method
 
-    std::lock_guard<std::recursive_mutex> lk(cacheMutex);
-    std::string key = className + "." + methodName;
-    if (!signature.empty()) {
-        key += ":" + signature;
-    } else {
-        key += ":" + std::to_string(numParameters);
-    }
-    log_print(LOG_DEBUG, "Looking up method '%s'.", key.c_str());
-    auto mi = javaMethodCache[key];
+    std::string signature(signatureView);
+    log_print(LOG_DEBUG, "Looking up method '%s.%s:%s' (%d parameters).", className.c_str(), methodName.c_str(), signature.c_str(), numParameters);
 
-    if (!mi) {
-        //
-        // First time we have looked up this exact method.  Either look it up using JNI if we have a signature or
-        // using Java if we don't.
-        //
-        mi = new MethodInfo();
+    //
+    // First time we have looked up this exact method.  Either look it up using JNI if we have a signature (or the
+    // resolution manifest has one from a previous run) or using Java if we don't.
+    //
+    // First find the class.
+    //
+    jclass class_ = getClass(className);
+    jmethodID methodID = nullptr;
 
-        //
-        // First find the class.
-        //
-        mi->class_ = getClass(className);
-        assertm(mi->class_, "Should never happen due to assert in getClass");
+    //
+    // A manifest entry only exists if this signature (or lack of one) needed the reflective lookup last time, so
+    // try the recorded descriptor first.
+    //
+    ManifestMember manifestMember{isStatic ? MANIFEST_STATIC_METHOD : MANIFEST_METHOD, className, methodName, signatureView, numParameters};
+    auto manifestSignature = findManifestDescriptor(manifestMember);
+    if (manifestSignature) {
+        signature = *manifestSignature;
+    }
 
+    //
+    // Now get the method.  Different mechanism depending on whether we have a signature or not.
+    //
+    if (!signature.empty()) {
         //
-        // Now get the method.  Different mechanism depending on whether we have a signature or not.
+        // We have a signature so use JNI to look up the exact method.
         //
-        if (!signature.empty()) {
-            //
-            // We have a signature so use JNI to look up the exact method.
-            //
-            if (isStatic) {
-                mi->methodID = env()->GetStaticMethodID(mi->class_, methodName.c_str(), signature.c_str());
-            } else {
-                mi->methodID = env()->GetMethodID(mi->class_, methodName.c_str(), signature.c_str());
-            }
+        if (isStatic) {
+            methodID = env()->GetStaticMethodID(class_, methodName.c_str(), signature.c_str());
+        } else {
+            methodID = env()->GetMethodID(class_, methodName.c_str(), signature.c_str());
+        }
 
-            if (mi->methodID) {
-                getLogger()->debug("Signature " + signature + " found method for " + className + "." + methodName);
+        if (methodID) {
+            getLogger()->debug("Signature " + signature + " found method for " + className + "." + methodName);
 
-                // We have the method but check to see if it is "exportable."  If a class is in an export required package
-                // it must be annotated with @ExportToNative to be "exportable" UNLESS it is JavaToNativeExporter which
-                // is always exportable (to prevent an infinite loop/deadlock right here...)
-                if (className != "dev.tmich.jnipp.JavaToNativeExporter") {
-                    jobject methodObject = env()->ToReflectedMethod(mi->class_, mi->methodID, jboolean(isStatic));
-                    assertm(methodObject, "ToReflectedMethod should not fail");
-                    assertm(jIsExportable(methodObject), "Method is not exported!  Annotate with ExportToNative!");
+            // We have the method but check to see if it is "exportable."  If a class is in an export required package
+            // it must be annotated with @ExportToNative to be "exportable" UNLESS it is JavaToNativeExporter which
+            // is always exportable (to prevent an infinite loop/deadlock right here...)
+            if (className != "dev.tmich.jnipp.JavaToNativeExporter") {
+                jobject methodObject = env()->ToReflectedMethod(class_, methodID, jboolean(isStatic));
+                if (!methodObject) {
+                    resolutionFailed("ToReflectedMethod failed for " + className + "." + methodName);
+                }
+                if (!jIsExportable(methodObject)) {
+                    resolutionFailed("Method " + className + "." + methodName + " is not exported!  Annotate with ExportToNative!");
                 }
-            } else {
-                getLogger()->warning("Signature " + signature + " DID NOT FIND method for " + className + "." + methodName);
+            }
+        } else {
+            // Clear the NoSuchMethodError so the reflective lookup below can run
+            env()->ExceptionClear();
+            getLogger()->warning("Signature " + signature + " DID NOT FIND method for " + className + "." + methodName);
+            if (manifestSignature) {
+                discardManifestDescriptor(manifestMember);
             }
         }
+    }
 
-        // Either there was no signature or the signature didn't match a method
-        if (!mi->methodID) {
-            //
-            // Have java scan through all the methods looking for the one we want.  All exportability tests are baked in.
-            // Returns a Method jobject.  Use JNI to convert to methodID.
-            //
-            jobject methodObject = jLookupJavaMember(className, methodName, isStatic, numParameters);
-            assertm(methodObject, "Method  couldn't be exported");
+    // Either there was no signature or the signature didn't match a method
+    if (!methodID) {
+        //
+        // Have java scan through all the methods looking for the one we want.  All exportability tests are baked in.
+        // Returns a Method jobject.  Use JNI to convert to methodID.
+        //
+        jobject methodObject = jLookupJavaMember(className, methodName, isStatic, numParameters);
+        if (!methodObject) {
+            resolutionFailed("Method " + className + "." + methodName + " not found or not exported");
+        }
 
-            mi->methodID = env()->FromReflectedMethod(methodObject);
-            assertm(mi->methodID, "FromReflectedMethod shouldn't fail.");
+        methodID = env()->FromReflectedMethod(methodObject);
+        if (!methodID) {
+            resolutionFailed("FromReflectedMethod failed for " + className + "." + methodName);
         }
 
-        javaMethodCache[key] = mi;
+        recordManifestDescriptor(manifestMember, methodObject);
     }
-    return mi;
+
+    return cacheMethodInfo(key, class_, methodID);
 }
 
 
@@ -338,78 +481,368 @@ MethodInfo  *getMethodInfo(const std::string& className, const std::string& meth
 //
 // get the FieldInfo for this Field (InstanceField, StaticField, or Constructor)
 //
-FieldInfo  *getFieldInfo(const std::string& className, const std::string& fieldName, const std::string& signature, bool isStatic) {
+FieldInfo  *getFieldInfo(const std::string& className, const std::string& fieldName, std::string_view signatureView, bool isStatic) {
+    MemberKeyView key(className, fieldName, {}, -1);
+    if (auto cached = javaFieldCache.find(key)) {
+        return *cached;
+    }
 
     JniLocalReferenceScope refs;  // Cleans up any local references created in this field
 
-    std::lock_guard<std::recursive_mutex> lk(cacheMutex);
-    std::string key = className + "." + fieldName;
-    log_print(LOG_DEBUG, "Looking up field '%s'.", key.c_str());
-    auto fi = javaFieldCache[key];
+    std::string signature(signatureView);
+    log_print(LOG_DEBUG, "Looking up field '%s.%s'.", className.c_str(), fieldName.c_str());
 
-    if (!fi) {
-        jobject fieldObject;
+    jobject fieldObject = nullptr;
+    jfieldID fieldID = nullptr;
 
-        //
-        // First time we have looked up this exact field.  Either look it up using JNI if we have a signature or
-        // using Java if we don't.
-        //
-        fi = new FieldInfo();
+    //
+    // First time we have looked up this exact field.  Either look it up using JNI if we have a signature (or the
+    // resolution manifest has one from a previous run) or using Java if we don't.
+    //
+    // First find the class.
+    //
+    jclass class_ = getClass(className);
+
+    ManifestMember manifestMember{isStatic ? MANIFEST_STATIC_FIELD : MANIFEST_FIELD, className, fieldName, signatureView, -1};
+    std::optional<std::string> manifestSignature;
+    if (signature.empty()) {
+        manifestSignature = findManifestDescriptor(manifestMember);
+        if (manifestSignature) {
+            signature = *manifestSignature;
+        }
+    }
 
+    //
+    // Now get the field.  Different mechanism depending on whether we have a signature or not.
+    //
+    if (!signature.empty()) {
         //
-        // First find the class.
+        // We have a signature so use JNI to lookup the exact field.
         //
-        jclass class_ = getClass(className);
-        assertm(class_, "Should never happen due to assert in getClass");
+        if (isStatic) {
+            fieldID = env()->GetStaticFieldID(class_, fieldName.c_str(), signature.c_str());
+        } else {
+            fieldID = env()->GetFieldID(class_, fieldName.c_str(), signature.c_str());
+        }
 
-        //
-        // Now get the field.  Different mechanism depending on whether we have a signature or not.
-        //
-        if (!signature.empty()) {
-            //
-            // We have a signature so use JNI to lookup the exact field.
-            //
-            if (isStatic) {
-                fi->fieldID = env()->GetStaticFieldID(class_, fieldName.c_str(), signature.c_str());
-            } else {
-                fi->fieldID = env()->GetFieldID(class_, fieldName.c_str(), signature.c_str());
+        if (!fieldID && manifestSignature) {
+            // The class changed in a way the fingerprint didn't catch.  Fall back to the reflective lookup.
+            env()->ExceptionClear();
+            discardManifestDescriptor(manifestMember);
+        } else {
+            if (!fieldID) {
+                resolutionFailed("Field " + className + "." + fieldName + " not found.  Check signature " + signature);
             }
-            assertm(fi->fieldID, "fieldID lookup failure.  Check signature.");
 
             //
             // Next convert fieldID to java.lang.reflect.Field object
             //
-            fieldObject = env()->ToReflectedField(class_, fi->fieldID, jboolean(isStatic));
-            assertm(fieldObject, "ToReflectedField should not fail");
+            fieldObject = env()->ToReflectedField(class_, fieldID, jboolean(isStatic));
+            if (!fieldObject) {
+                resolutionFailed("ToReflectedField failed for " + className + "." + fieldName);
+            }
 
             // We have the field but check to see if it is "exportable."
-            assertm(jIsExportable(fieldObject), "Field is not exported!  Annotate with ExportToNative!");
-        } else {
-            //
-            // Have java scan through all the fields looking for the one we want.  All exportability tests are baked in.
-            // Returns a Field jobject.  Use JNI to convert to fieldID.
-            //
-            fieldObject = jLookupJavaField(className, fieldName, isStatic);
-            assertm(fieldObject, "Field  couldn't be exported");
-
-            fi->fieldID = env()->FromReflectedField(fieldObject);
-            assertm(fi->fieldID, "FromReflectedField shouldn't fail.");
+            if (!jIsExportable(fieldObject)) {
+                resolutionFailed("Field " + className + "." + fieldName + " is not exported!  Annotate with ExportToNative!");
+            }
         }
+    }
 
+    if (!fieldID) {
         //
-        // If a static field is in a superclass, accessing it through the base class jclass seems to cause an exception.  Now that we have the fieldObject,
-        // ask IT what it's declaring class should be.
-        //
-        // Maybe only need this for static fields?  In base classes?  We know if it is static but don't really know the declaring class here.
+        // Have java scan through all the fields looking for the one we want.  All exportability tests are baked in.
+        // Returns a Field jobject.  Use JNI to convert to fieldID.
         //
-        auto localref = (jclass) jGetFieldClass(fieldObject);
-        fi->class_ = (jclass) env()->NewGlobalRef(localref);
-        env()->DeleteLocalRef(localref);
-        assertm(fi->class_, "Field.getDeclaringClass shouldn't return null");
+        fieldObject = jLookupJavaField(className, fieldName, isStatic);
+        if (!fieldObject) {
+            resolutionFailed("Field " + className + "." + fieldName + " not found or not exported");
+        }
 
-        javaFieldCache[key] = fi;
+        fieldID = env()->FromReflectedField(fieldObject);
+        if (!fieldID) {
+            resolutionFailed("FromReflectedField failed for " + className + "." + fieldName);
+        }
+
+        recordManifestDescriptor(manifestMember, fieldObject);
     }
-    return fi;
+
+    return cacheFieldInfo(key, (jclass) jGetFieldClass(fieldObject), fieldID);
+}
+
+static MemberKeyView memberKey(const MemberRequest& request) {
+    if (request.numParameters < 0) {
+        return MemberKeyView(request.className, request.memberName, {}, -1);
+    }
+    return MemberKeyView(request.className, request.memberName, request.signature,
+                         request.signature.empty() ? request.numParameters : -1);
+}
+
+static ManifestMember manifestMember(const MemberRequest& request) {
+    ManifestMemberKind kind;
+    if (request.numParameters < 0) {
+        kind = request.isStatic ? MANIFEST_STATIC_FIELD : MANIFEST_FIELD;
+    } else {
+        kind = request.isStatic ? MANIFEST_STATIC_METHOD : MANIFEST_METHOD;
+    }
+    return ManifestMember{kind, request.className, request.memberName, request.signature, request.numParameters};
+}
+
+//
+// Find the member with JNI alone, using its signature or the descriptor the resolution manifest recorded for it (the
+// same way getMethodInfo/getFieldInfo would).  Returns it reflected, for lookupJavaMembers to check that it is
+// exportable, or null if it has to be looked up by name.
+//
+static jobject reflectBySignature(const MemberRequest& request) {
+    bool isField = request.numParameters < 0;
+    ManifestMember member = manifestMember(request);
+    std::string signature = request.signature;
+    std::optional<std::string> manifestSignature;
+    if (!isField || signature.empty()) {
+        manifestSignature = findManifestDescriptor(member);
+        if (manifestSignature) {
+            signature = *manifestSignature;
+        }
+    }
+    if (signature.empty()) {
+        return nullptr;
+    }
+
+    jclass class_ = getClass(request.className);
+    jobject reflected = nullptr;
+    if (isField) {
+        jfieldID fieldID = request.isStatic ? env()->GetStaticFieldID(class_, request.memberName.c_str(), signature.c_str())
+                                            : env()->GetFieldID(class_, request.memberName.c_str(), signature.c_str());
+        if (fieldID) {
+            reflected = env()->ToReflectedField(class_, fieldID, jboolean(request.isStatic));
+        }
+    } else {
+        jmethodID methodID = request.isStatic ? env()->GetStaticMethodID(class_, request.memberName.c_str(), signature.c_str())
+                                              : env()->GetMethodID(class_, request.memberName.c_str(), signature.c_str());
+        if (methodID) {
+            reflected = env()->ToReflectedMethod(class_, methodID, jboolean(request.isStatic));
+        }
+    }
+    if (!reflected) {
+        env()->ExceptionClear();
+        if (manifestSignature) {
+            discardManifestDescriptor(member);
+        }
+    }
+    return reflected;
+}
+
+//
+// Resolve and cache a set of members with a single call into Java.  Members whose signature (or manifest descriptor)
+// finds them with JNI are sent along already found, for Java to check they are exportable.  The rest are looked up
+// by name.  Java returns each member with its declaring class, so nothing needs another call per member.
+//
+size_t resolveMembers(const std::vector<MemberRequest>& requests) {
+    JniLocalReferenceScope refs(int(2 * requests.size()) + 16);  // Cleans up any local references created in this method
+
+    size_t resolved = 0;
+    std::vector<const MemberRequest*> pending;
+    std::vector<jobject> found;
+    for (auto& request : requests) {
+        bool isField = request.numParameters < 0;
+        auto key = memberKey(request);
+        if (isField ? javaFieldCache.find(key).has_value() : javaMethodCache.find(key).has_value()) {
+            ++resolved;
+            continue;
+        }
+
+        try {
+            jobject reflected = reflectBySignature(request);
+            if (!reflected && isField && !request.signature.empty()) {
+                // getFieldInfo doesn't fall back to a lookup by name for a field with the wrong signature either
+                log_print(LOG_WARN, "resolveMembers: %s.%s not found with signature %s", request.className.c_str(), request.memberName.c_str(), request.signature.c_str());
+                continue;
+            }
+            pending.push_back(&request);
+            found.push_back(reflected);
+        } catch (const std::exception& ex) {
+            log_print(LOG_WARN, "resolveMembers: %s.%s failed to resolve: %s", request.className.c_str(), request.memberName.c_str(), ex.what());
+            env()->ExceptionClear();
+        }
+    }
+
+    if (pending.empty()) {
+        return resolved;
+    }
+
+    //
+    // One call into Java for all of them.
+    //
+    auto count = jsize(pending.size());
+    jclass stringClass = getClass("java.lang.String");
+    jobjectArray classNames = env()->NewObjectArray(count, stringClass, nullptr);
+    jobjectArray memberNames = env()->NewObjectArray(count, stringClass, nullptr);
+    jbooleanArray isStatic = env()->NewBooleanArray(count);
+    jintArray numParameters = env()->NewIntArray(count);
+    jobjectArray foundMembers = env()->NewObjectArray(count, getClass("java.lang.reflect.AccessibleObject"), nullptr);
+    if (!classNames || !memberNames || !isStatic || !numParameters || !foundMembers) {
+        resolutionFailed("Out of memory allocating lookup arrays");
+    }
+
+    std::vector<jboolean> statics(pending.size());
+    std::vector<jint> arities(pending.size());
+    for (jsize i = 0; i < count; i++) {
+        jstring className = toJString(pending[i]->className);
+        jstring memberName = toJString(pending[i]->memberName);
+        env()->SetObjectArrayElement(classNames, i, className);
+        env()->SetObjectArrayElement(memberNames, i, memberName);
+        env()->DeleteLocalRef(className);
+        env()->DeleteLocalRef(memberName);
+        if (found[i]) {
+            env()->SetObjectArrayElement(foundMembers, i, found[i]);
+        }
+        statics[i] = jboolean(pending[i]->isStatic);
+        arities[i] = pending[i]->numParameters;
+    }
+    env()->SetBooleanArrayRegion(isStatic, 0, count, statics.data());
+    env()->SetIntArrayRegion(numParameters, 0, count, arities.data());
+
+    jobjectArray results;
+    try {
+        results = static_cast<jobjectArray>(jLookupJavaMembers(classNames, memberNames, isStatic, numParameters, foundMembers));
+    } catch (const std::exception& ex) {
+        log_print(LOG_WARN, "resolveMembers: lookupJavaMembers failed: %s", ex.what());
+        env()->ExceptionClear();
+        return resolved;
+    }
+    if (!results) {
+        return resolved;
+    }
+    auto members = static_cast<jobjectArray>(env()->GetObjectArrayElement(results, 0));
+    auto declaringClasses = static_cast<jobjectArray>(env()->GetObjectArrayElement(results, 1));
+
+    for (jsize i = 0; i < count; i++) {
+        const MemberRequest& request = *pending[i];
+        jobject member = env()->GetObjectArrayElement(members, i);
+        if (!member) {
+            // Not found or not exportable.  Left to fail with the normal error on first use.
+            continue;
+        }
+        auto declaringClass = static_cast<jclass>(env()->GetObjectArrayElement(declaringClasses, i));
+
+        try {
+            if (request.numParameters < 0) {
+                jfieldID fieldID = env()->FromReflectedField(member);
+                if (!fieldID) {
+                    resolutionFailed("FromReflectedField failed for " + request.className + "." + request.memberName);
+                }
+                if (!found[i]) {
+                    recordManifestDescriptor(manifestMember(request), member);
+                }
+                cacheFieldInfo(memberKey(request), declaringClass, fieldID);
+            } else {
+                jmethodID methodID = env()->FromReflectedMethod(member);
+                if (!methodID) {
+                    resolutionFailed("FromReflectedMethod failed for " + request.className + "." + request.memberName);
+                }
+                if (!found[i]) {
+                    recordManifestDescriptor(manifestMember(request), member);
+                }
+                cacheMethodInfo(memberKey(request), getClass(request.className), methodID);
+            }
+            ++resolved;
+        } catch (const std::exception& ex) {
+            log_print(LOG_WARN, "resolveMembers: %s.%s failed to resolve: %s", request.className.c_str(), request.memberName.c_str(), ex.what());
+        }
+        env()->DeleteLocalRef(member);
+        env()->DeleteLocalRef(declaringClass);
+    }
+
+    log_print(LOG_DEBUG, "resolveMembers: %zu of %zu members resolved with one call into Java for %zu.", resolved, requests.size(), pending.size());
+    return resolved;
+}
+
+static constexpr unsigned kMaxTransferThreads = 8;
+
+bool runChunkedTransfer(size_t total, const ArrayTransferOptions& options, const std::function<void(size_t offset, size_t count)>& copyChunk) {
+    size_t chunkElements = std::max<size_t>(options.chunkElements, 1);
+    size_t chunks = (total + chunkElements - 1) / chunkElements;
+    unsigned threads = options.threads != 0 ? options.threads : std::min(kMaxTransferThreads, std::max(1u, std::thread::hardware_concurrency()));
+    size_t workerCount = std::min<size_t>(threads, chunks) - (chunks > 0 ? 1 : 0);
+
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<bool> stop{false};
+    std::atomic<bool> cancelled{false};
+    std::mutex progressMutex;
+    size_t copied = 0;
+    std::mutex failureMutex;
+    std::exception_ptr failure;
+
+    //
+    // Each thread claims chunks until they run out or the transfer is stopped.  Nothing is allowed to escape a
+    // worker (that would terminate the process), so the first exception from a copy, a pending Java exception or
+    // the progress callback stops the transfer and is rethrown on the calling thread once every worker is done.
+    //
+    auto copyChunks = [&]() {
+        try {
+            while (!stop) {
+                size_t chunk = nextChunk++;
+                if (chunk >= chunks) {
+                    return;
+                }
+                size_t offset = chunk * chunkElements;
+                size_t count = std::min(chunkElements, total - offset);
+                copyChunk(offset, count);
+                checkForExceptions();
+                if (options.progress) {
+                    std::lock_guard<std::mutex> lock(progressMutex);
+                    copied += count;
+                    if (!options.progress(copied, total)) {
+                        cancelled = true;
+                        stop = true;
+                    }
+                }
+            }
+        } catch (...) {
+            stop = true;
+            std::lock_guard<std::mutex> lock(failureMutex);
+            if (!failure) {
+                failure = std::current_exception();
+            }
+        }
+    };
+
+    {
+        // Stops and joins the workers however this block is left, including a failure starting one of them
+        std::vector<std::thread> workers;
+        struct JoinWorkers {
+            std::vector<std::thread>& workers;
+            std::atomic<bool>& stop;
+            ~JoinWorkers() {
+                if (std::uncaught_exceptions() > 0) {
+                    stop = true;
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+        } joinWorkers{workers, stop};
+
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers.emplace_back([&copyChunks]() {
+                // A worker that can't attach leaves its share to the others
+                if (!attachCurrentThread()) {
+                    return;
+                }
+                struct DetachOnExit {
+                    ~DetachOnExit() { detachCurrentThread(); }
+                } detachOnExit;
+                copyChunks();
+            });
+        }
+        copyChunks();
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+    return !cancelled;
 }
 
 static std::string javaBasePackageName;
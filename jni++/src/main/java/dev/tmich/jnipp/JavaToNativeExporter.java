@@ -15,11 +15,22 @@ package dev.tmich.jnipp;
 import dev.tmich.jnipp.logger.JniLogger;
 import dev.tmich.jnipp.logger.JniPrintStreamLogger;
 
-import java.lang.annotation.Annotation;
+import java.io.IOException;
+import java.io.InputStream;
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
 import java.lang.reflect.*;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
 import java.util.HashMap;
 import java.util.Map;
+import java.util.Set;
 import java.util.TreeMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.zip.CRC32;
 
 //
 // Java-land support code for calling Java from native code.
@@ -41,13 +52,125 @@ public class JavaToNativeExporter {
     // matching package wins.  So if you require annotations on com.example but don't require
     // annotations on com.example.generated, then com.example.backend.parsers.JSon would
     // require annotation to be exportable but com.example.generated.swig.NativeClass would not.
-    private static final Map<String, Boolean> sAnnotationRequiredPackages = new HashMap<>();
+    //
+    // Export checks run for every member resolved from native code so they are lock free.  The
+    // configured packages are kept in an immutable trie (one level per package name segment)
+    // along with a per-class cache of decisions.  Both are replaced together, copy-on-write, by
+    // setRequiresExport so readers only ever see a consistent pair and never see stale cache
+    // entries.  The cache holds its classes weakly so that checking a class never keeps it, or its
+    // class loader, from being unloaded.  (A ConcurrentHashMap with weak keys rather than
+    // ClassValue since ClassValue needs Android API 34.)
+    private static final class PackageTrie {
+        static final PackageTrie EMPTY = new PackageTrie(null, new HashMap<String, PackageTrie>());
+
+        private final Boolean required;  // null if this package isn't configured itself
+        private final Map<String, PackageTrie> children;
+
+        private PackageTrie(Boolean required, Map<String, PackageTrie> children) {
+            this.required = required;
+            this.children = children;
+        }
+
+        // Copy of this trie with the rule for the package made of segments[index..] set.  Only the
+        // nodes on the path are copied, the rest are shared.
+        PackageTrie with(String[] segments, int index, boolean isAnnotationRequired) {
+            if (index == segments.length) {
+                return new PackageTrie(isAnnotationRequired, children);
+            }
+            PackageTrie child = children.get(segments[index]);
+            if (child == null) {
+                child = EMPTY;
+            }
+            Map<String, PackageTrie> newChildren = new HashMap<>(children);
+            newChildren.put(segments[index], child.with(segments, index + 1, isAnnotationRequired));
+            return new PackageTrie(required, newChildren);
+        }
+
+        // Rule of the longest configured package containing packageName, false if there is none
+        boolean isRequired(String packageName) {
+            boolean currentRequired = false;  // Defaults to false so that packages with no configuration do not require export
+            PackageTrie node = this;
+            int start = 0;
+            while (start <= packageName.length()) {
+                int end = packageName.indexOf('.', start);
+                if (end < 0) {
+                    end = packageName.length();
+                }
+                node = node.children.get(packageName.substring(start, end));
+                if (node == null) {
+                    break;
+                }
+                if (node.required != null) {
+                    currentRequired = node.required;
+                }
+                start = end + 1;
+            }
+            return currentRequired;
+        }
+    }
+
+    // Weak, identity based key for the class cache
+    private static final class ClassKey extends WeakReference<Class<?>> {
+        private final int hash;
+
+        ClassKey(Class<?> cls, ReferenceQueue<Class<?>> queue) {
+            super(cls, queue);
+            hash = System.identityHashCode(cls);
+        }
+
+        @Override
+        public int hashCode() {
+            return hash;
+        }
+
+        @Override
+        public boolean equals(Object other) {
+            if (this == other) {
+                return true;
+            }
+            if (!(other instanceof ClassKey)) {
+                return false;
+            }
+            Class<?> cls = get();
+            return cls != null && cls == ((ClassKey) other).get();
+        }
+    }
+
+    private static final class ExportRules {
+        final PackageTrie packages;
+        // Whether every member of a class is exportable (false means it depends on the member's annotation)
+        private final ConcurrentHashMap<ClassKey, Boolean> classExported = new ConcurrentHashMap<>();
+        private final ReferenceQueue<Class<?>> unloadedClasses = new ReferenceQueue<>();
+
+        ExportRules(PackageTrie packages) {
+            this.packages = packages;
+        }
+
+        Boolean getClassExported(Class<?> cls) {
+            return classExported.get(new ClassKey(cls, null));
+        }
+
+        void putClassExported(Class<?> cls, boolean exported) {
+            // Drop the entries of classes that have been unloaded since the last insert
+            Reference<? extends Class<?>> unloaded;
+            while ((unloaded = unloadedClasses.poll()) != null) {
+                classExported.remove(unloaded);
+            }
+            classExported.putIfAbsent(new ClassKey(cls, unloadedClasses), exported);
+        }
+    }
+
+    private static final Object sExportRulesLock = new Object();
+    private static volatile ExportRules sExportRules = new ExportRules(PackageTrie.EMPTY);
+
     public static void setRequiresExport(String packageName, boolean isAnnotationRequired) {
         if (packageName == null) {
             return;
         }
-        synchronized (sAnnotationRequiredPackages) {
-            sAnnotationRequiredPackages.put(packageName, isAnnotationRequired);
+        synchronized (sExportRulesLock) {
+            // Only writers lock, to keep concurrent updates from losing each other's rules
+            PackageTrie packages = sExportRules.packages.with(packageName.split("\\."), 0, isAnnotationRequired);
+            sExportRules = new ExportRules(packages);
         }
     }
     public static boolean doesPackageRequireExport(String packageName) {
@@ -55,61 +178,44 @@ public class JavaToNativeExporter {
         if (packageName == null) {
             return false;
         }
-
-        String currentLongest = null;
-        Boolean currentRequired = false;  // Defaults to false so that packages with no configuration do not require export
-        synchronized (sAnnotationRequiredPackages) {
-            for (Map.Entry<String, Boolean> entry : sAnnotationRequiredPackages.entrySet()) {
-                String configuredPackage = entry.getKey();
-                if (packageMatches(packageName, configuredPackage)) {
-                    if (currentLongest == null || currentLongest.length() < configuredPackage.length()) {
-                        currentLongest = configuredPackage;
-                        currentRequired = entry.getValue();
-                    }
-                }
-            }
-        }
-        return currentRequired;
-    }
-    private static boolean packageMatches(String packageName, String possibleMatchPackage) {
-        if (packageName.equals(possibleMatchPackage)) {
-            return true;
-        }
-        return packageName.startsWith(possibleMatchPackage + ".");
+        return sExportRules.packages.isRequired(packageName);
     }
 
     //
     // Does the element have the ExportToNative annotations?
     //
     private static boolean hasExportToNative(AnnotatedElement element) {
-        Annotation[] annotations = element.getAnnotations();
-        for (Annotation annotation : annotations) {
-            if (annotation instanceof ExportToNative) {
-                return true;
-            }
-        }
-        return false;
+        return element.isAnnotationPresent(ExportToNative.class);
     }
 
     //
-    // Can the constructor, method, or field be exported to native code
+    // Are all the members of the class exportable without looking at the members themselves?
     //
-    @SuppressWarnings("BooleanMethodIsAlwaysInverted")
-    private static boolean isExportable(Member member) {
-        Class<?> cls = member.getDeclaringClass();
+    private static boolean isClassExported(ExportRules rules, Class<?> cls) {
+        Boolean exported = rules.getClassExported(cls);
+        if (exported == null) {
+            exported = computeClassExported(rules.packages, cls);
+            rules.putClassExported(cls, exported);
+        }
+        return exported;
+    }
 
+    private static boolean computeClassExported(PackageTrie packages, Class<?> cls) {
         // This class must always be exportable
         if (cls.equals(JavaToNativeExporter.class)) {
             return true;
         }
 
         // Check to see if the package is required to have ExportToNative.  By default,
-        // they do not so that you can export the SDK or 3rd party libraries.
-        if (!doesPackageRequireExport(cls.getPackage().getName())) {
+        // they do not so that you can export the SDK or 3rd party libraries.  The package
+        // comes from the name since getPackage() can be null depending on the class loader.
+        String className = cls.getName();
+        int lastDot = className.lastIndexOf('.');
+        if (!packages.isRequired(lastDot < 0 ? "" : className.substring(0, lastDot))) {
             return true;
         }
 
-        // First check to see if the entire class is exported
+        // Then check to see if the entire class (or one it is nested in) is exported
         do {
             if (hasExportToNative(cls)) {
                 return true;
@@ -117,6 +223,18 @@ public class JavaToNativeExporter {
             cls = cls.getDeclaringClass();
         } while (cls != null);
 
+        return false;
+    }
+
+    //
+    // Can the constructor, method, or field be exported to native code
+    //
+    @SuppressWarnings("BooleanMethodIsAlwaysInverted")
+    private static boolean isExportable(Member member) {
+        if (isClassExported(sExportRules, member.getDeclaringClass())) {
+            return true;
+        }
+
         // Otherwise check to see if it is annotated
         return hasExportToNative((AnnotatedElement) member);
     }
@@ -285,6 +403,176 @@ public class JavaToNativeExporter {
         return foundField;
     }
 
+    //
+    // Called from native code to resolve many members with one call (see resolveMembers in Utilities.cpp).  If native
+    // code already found entry i with its signature, found[i] is that member and only needs to be checked for
+    // exportability.  Otherwise it is looked up as lookupJavaMember would, or as lookupJavaField would if
+    // numParameters[i] is -1.  Returns two arrays: the members, null where not found, not exportable or failed to
+    // load, and the declaring class of each, so native code needs no further call per member.
+    //
+    @ExportToNative
+    private static Object[][] lookupJavaMembers(String[] classNames, String[] memberNames, boolean[] isStatic, int[] numParameters, AccessibleObject[] found) {
+        AccessibleObject[] members = new AccessibleObject[classNames.length];
+        Class<?>[] declaringClasses = new Class<?>[classNames.length];
+        for (int i = 0; i < classNames.length; i++) {
+            try {
+                AccessibleObject member;
+                if (found[i] != null) {
+                    // JavaToNativeExporter is always exportable, as in getMethodInfo
+                    Class<?> declaringClass = ((Member) found[i]).getDeclaringClass();
+                    member = declaringClass == JavaToNativeExporter.class || isExportable((Member) found[i]) ? found[i] : null;
+                    if (member == null) {
+                        log.warning("lookupJavaMembers: %s.%s is not exported", classNames[i], memberNames[i]);
+                    }
+                } else if (numParameters[i] < 0) {
+                    member = lookupJavaField(classNames[i], memberNames[i], isStatic[i]);
+                } else {
+                    member = lookupJavaMember(classNames[i], memberNames[i], isStatic[i], numParameters[i]);
+                }
+                if (member != null) {
+                    members[i] = member;
+                    declaringClasses[i] = ((Member) member).getDeclaringClass();
+                }
+            } catch (RuntimeException | LinkageError e) {
+                log.warning("lookupJavaMembers: failed to look up %s.%s: %s", classNames[i], memberNames[i], e.toString());
+            }
+        }
+        return new Object[][] { members, declaringClasses };
+    }
+
+    //
+    // Called from native code to convert a whole String[] in one call (see jStringArrayToVector in Strings.cpp).
+    // Each string is written as its UTF-8 length (-1 for null), an int in native byte order, followed by its UTF-8
+    // bytes.
+    //
+    @ExportToNative
+    private static byte[] packStrings(String[] strings) {
+        byte[][] encoded = new byte[strings.length][];
+        // Throws ArithmeticException rather than wrapping if the strings don't fit in one array
+        int total = Math.multiplyExact(4, strings.length);
+        for (int i = 0; i < strings.length; i++) {
+            if (strings[i] != null) {
+                encoded[i] = strings[i].getBytes(StandardCharsets.UTF_8);
+                total = Math.addExact(total, encoded[i].length);
+            }
+        }
+
+        ByteBuffer packed = ByteBuffer.allocate(total).order(ByteOrder.nativeOrder());
+        for (byte[] bytes : encoded) {
+            if (bytes == null) {
+                packed.putInt(-1);
+            } else {
+                packed.putInt(bytes.length);
+                packed.put(bytes);
+            }
+        }
+        return packed.array();
+    }
+
+    //
+    // The reverse of packStrings, called from native code to create a String[] of count strings in one call.
+    //
+    @ExportToNative
+    private static String[] unpackStrings(byte[] packed, int count) {
+        ByteBuffer buffer = ByteBuffer.wrap(packed).order(ByteOrder.nativeOrder());
+        String[] strings = new String[count];
+        for (int i = 0; i < count; i++) {
+            int length = buffer.getInt();
+            if (length >= 0) {
+                strings[i] = new String(packed, buffer.position(), length, StandardCharsets.UTF_8);
+                buffer.position(buffer.position() + length);
+            }
+        }
+        return strings;
+    }
+
+    //
+    // Called from native code for the resolution manifest.  Identifies the version of a class by a CRC32 of
+    // its class file and those of its superclasses (which members may be inherited from).  Returns 0 if the
+    // class file can't be read as a resource (as on Android) so the class is never recorded.
+    //
+    @ExportToNative
+    private static long classFingerprint(String className) {
+        Class<?> cls;
+        try {
+            cls = Class.forName(className);
+        } catch (ClassNotFoundException e) {
+            return 0;
+        }
+
+        CRC32 crc = new CRC32();
+        byte[] buffer = new byte[8192];
+        for (Class<?> currentClass = cls; currentClass != null; currentClass = currentClass.getSuperclass()) {
+            String name = currentClass.getName();
+            InputStream in = currentClass.getResourceAsStream(name.substring(name.lastIndexOf('.') + 1) + ".class");
+            if (in == null) {
+                // The class itself is required, superclasses from the platform may not be readable
+                if (currentClass == cls) {
+                    return 0;
+                }
+                continue;
+            }
+            try {
+                int count;
+                while ((count = in.read(buffer)) > 0) {
+                    crc.update(buffer, 0, count);
+                }
+            } catch (IOException e) {
+                return 0;
+            } finally {
+                try {
+                    in.close();
+                } catch (IOException ignored) {
+                }
+            }
+        }
+
+        // 0 means no fingerprint
+        long value = crc.getValue();
+        return value == 0 ? 1 : value;
+    }
+
+    //
+    // Called from native code for the resolution manifest.  The JNI descriptor of a member found by
+    // lookupJavaMember or lookupJavaField, e.g. "(ILjava/lang/String;)V" or "[J".
+    //
+    @ExportToNative
+    private static String memberDescriptor(AccessibleObject member) {
+        if (member instanceof Field) {
+            return typeDescriptor(((Field) member).getType());
+        }
+
+        Class<?>[] parameterTypes;
+        Class<?> returnType;
+        if (member instanceof Method) {
+            parameterTypes = ((Method) member).getParameterTypes();
+            returnType = ((Method) member).getReturnType();
+        } else {
+            parameterTypes = ((Constructor<?>) member).getParameterTypes();
+            returnType = void.class;
+        }
+
+        StringBuilder descriptor = new StringBuilder("(");
+        for (Class<?> parameterType : parameterTypes) {
+            descriptor.append(typeDescriptor(parameterType));
+        }
+        return descriptor.append(')').append(typeDescriptor(returnType)).toString();
+    }
+
+    private static String typeDescriptor(Class<?> type) {
+        if (type.isArray()) return type.getName().replace('.', '/');
+        if (type == void.class) return "V";
+        if (type == boolean.class) return "Z";
+        if (type == byte.class) return "B";
+        if (type == char.class) return "C";
+        if (type == short.class) return "S";
+        if (type == int.class) return "I";
+        if (type == long.class) return "J";
+        if (type == float.class) return "F";
+        if (type == double.class) return "D";
+        return "L" + type.getName().replace('.', '/') + ";";
+    }
+
     private static String makeKey(Method m) {
         String desc = m.toString();
         String key = desc.substring(desc.indexOf(m.getName()));
@@ -370,6 +658,64 @@ public class JavaToNativeExporter {
         return JniLogger.LogLevel.values()[levelOrd];
     }
 
+    //
+    // Pooled direct buffers (see DirectBufferPool in Buffers.hpp).  A buffer lent from a native pool goes back to it
+    // with releasePooledBuffer, after which it must not be used.  Buffers lent with lendTracked are also returned
+    // when they are garbage collected.  That uses a PhantomReference per buffer and a daemon thread, rather than
+    // Cleaner which needs Java 9 and Android API 33.  Each reference carries the generation of its lend so one that
+    // is collected after an explicit release, when the block may have been lent again, is ignored.
+    //
+    // releasePooledBuffer has no generation to check, and lend() hands out the same ByteBuffer object for a block
+    // every time, so it must be called exactly once per lend.  Calling it again, or late, releases the block from
+    // whoever it has been lent to since.
+    //
+    public static native void releasePooledBuffer(ByteBuffer buffer);
+    private static native void releasePooledBlock(long address, long generation);
+
+    private static final class PooledBufferReference extends PhantomReference<ByteBuffer> {
+        final long address;
+        final long generation;
+
+        PooledBufferReference(ByteBuffer buffer, long address, long generation) {
+            super(buffer, pooledBufferQueue);
+            this.address = address;
+            this.generation = generation;
+        }
+    }
+
+    private static final ReferenceQueue<ByteBuffer> pooledBufferQueue = new ReferenceQueue<>();
+    // Keeps the references themselves reachable until they are enqueued
+    private static final Set<PooledBufferReference> pooledBufferReferences = ConcurrentHashMap.newKeySet();
+    private static Thread pooledBufferReleaser;
+
+    @ExportToNative
+    private static void trackPooledBuffer(ByteBuffer buffer, long address, long generation) {
+        pooledBufferReferences.add(new PooledBufferReference(buffer, address, generation));
+        startPooledBufferReleaser();
+    }
+
+    private static synchronized void startPooledBufferReleaser() {
+        if (pooledBufferReleaser != null) {
+            return;
+        }
+        pooledBufferReleaser = new Thread(new Runnable() {
+            @Override
+            public void run() {
+                while (true) {
+                    try {
+                        PooledBufferReference reference = (PooledBufferReference) pooledBufferQueue.remove();
+                        pooledBufferReferences.remove(reference);
+                        releasePooledBlock(reference.address, reference.generation);
+                    } catch (InterruptedException e) {
+                        return;
+                    }
+                }
+            }
+        }, "jni++ pooled buffer releaser");
+        pooledBufferReleaser.setDaemon(true);
+        pooledBufferReleaser.start();
+    }
+
     //
     // Support for adding JVM classloader pure native threads.  When a thread is created in native code we first
     // have it call bindToAppClassLoader, which then calls back into native code and then nativeThreadWrapper
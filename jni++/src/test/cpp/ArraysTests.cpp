@@ -0,0 +1,151 @@
+//
+// ArraysTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <array>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "JniPlusPlus.hpp"
+#include "JvmTestFixture.hpp"
+
+using namespace jni_pp;
+
+TEST_F(JvmTestFixture, ArrayRegionTest)
+{
+    JniLocalReferenceScope refs;
+    std::vector<int> values{1, 2, 3, 4, 5, 6, 7, 8};
+    jintArray array = PrimitiveArray<int>::create<jobject>(int(values.size()));
+    PrimitiveArray<int>::set(array, 0, std::span<const int>(values));
+
+    ASSERT_EQ(values, PrimitiveArray<int>::toVector(array));
+    ASSERT_EQ((std::vector<int>{3, 4, 5}), PrimitiveArray<int>::toVector(array, 2, 3));
+
+    int region[2];
+    PrimitiveArray<int>::getRegion(array, 6, std::span<int>(region));
+    ASSERT_EQ(7, region[0]);
+    ASSERT_EQ(8, region[1]);
+
+    ASSERT_THROW(PrimitiveArray<int>::getRegion(array, 7, 2, region), java_exception);
+
+    jbooleanArray flags = PrimitiveArray<bool>::create<jobject>(3);
+    bool flagValues[] = {true, false, true};
+    PrimitiveArray<bool>::set(flags, flagValues, 3);
+    ASSERT_EQ((std::vector<bool>{true, false, true}), PrimitiveArray<bool>::toVector(flags));
+}
+
+TEST_F(JvmTestFixture, ArrayElementsTest)
+{
+    JniLocalReferenceScope refs;
+    std::vector<int> values{1, 2, 3, 4};
+    jintArray array = PrimitiveArray<int>::create<jobject>(int(values.size()));
+    PrimitiveArray<int>::set(array, 0, std::span<const int>(values));
+
+    {
+        ArrayElements<int> elements(array);
+        ASSERT_EQ(4u, elements.size());
+        ASSERT_EQ(10, std::accumulate(elements.begin(), elements.end(), 0));
+    }
+
+    {
+        ArrayElements<int, ARRAY_READ_WRITE> elements(array);
+        for (int& element : elements.span()) {
+            element *= 2;
+        }
+        elements.commit();
+        ASSERT_EQ((std::vector<int>{2, 4, 6, 8}), PrimitiveArray<int>::toVector(array));
+        elements[0] = 100;
+    }
+    ASSERT_EQ(100, PrimitiveArray<int>::toVector(array)[0]);
+
+    {
+        CriticalArray<int, ARRAY_READ_WRITE> critical(array);
+        critical[1] = 200;
+    }
+    {
+        CriticalArray<int> critical(array);
+        ASSERT_EQ(200, critical[1]);
+    }
+}
+
+TEST_F(JvmTestFixture, ArrayConvertersTest)
+{
+    StaticMethod<std::vector<int>, std::span<const float>> jRoundFloats("dev.tmich.jnipp.test.TestStaticPrimitives", "roundFloats");
+    std::vector<float> samples{0.4f, 1.6f, -2.2f};
+    ASSERT_EQ((std::vector<int>{0, 2, -2}), jRoundFloats(samples));
+    ASSERT_TRUE(jRoundFloats(std::span<const float>()).empty());
+
+    StaticMethod<std::vector<bool>, std::vector<bool>> jInvertBooleans("dev.tmich.jnipp.test.TestStaticPrimitives", "invertBooleans");
+    ASSERT_EQ((std::vector<bool>{false, true, false}), jInvertBooleans(std::vector<bool>{true, false, true}));
+
+    StaticMethod<std::array<int, 3>, std::array<float, 3>> jRoundArray("dev.tmich.jnipp.test.TestStaticPrimitives", "roundFloats");
+    ASSERT_EQ((std::array<int, 3>{1, 2, 3}), jRoundArray(std::array<float, 3>{1.1f, 2.2f, 3.3f}));
+    StaticMethod<std::array<int, 2>, std::vector<float>> jRoundTooMany("dev.tmich.jnipp.test.TestStaticPrimitives", "roundFloats");
+    ASSERT_THROW(jRoundTooMany(samples), std::runtime_error);
+
+    StaticField<std::vector<double>> jStaticDoubles("dev.tmich.jnipp.test.TestStaticPrimitives", "staticDoubles");
+    ASSERT_EQ((std::vector<double>{1.5, 2.5, 3.5}), jStaticDoubles.get());
+    jStaticDoubles.set(std::vector<double>{4.5});
+    ASSERT_EQ((std::vector<double>{4.5}), jStaticDoubles.get());
+
+    static_assert(JniSignature<std::span<const float>>::signature().view() == "[F");
+    static_assert(JniSignature<std::array<long long, 4>>::typeName().view() == "long[]");
+}
+
+TEST_F(JvmTestFixture, ChunkedTransferTest)
+{
+    JniLocalReferenceScope refs;
+    std::vector<float> values(10'000);
+    std::iota(values.begin(), values.end(), 0.0f);
+    jfloatArray array = PrimitiveArray<float>::create<jobject>(int(values.size()));
+
+    size_t lastCopied = 0;
+    int calls = 0;
+    ArrayTransferOptions options;
+    options.chunkElements = 1000;
+    options.threads = 4;
+    options.progress = [&](size_t copied, size_t total) {
+        EXPECT_TRUE(copied > lastCopied);
+        EXPECT_EQ(10'000u, total);
+        lastCopied = copied;
+        ++calls;
+        return true;
+    };
+    ASSERT_TRUE(PrimitiveArray<float>::setRegionChunked(array, 0, std::span<const float>(values), options));
+    ASSERT_EQ(10, calls);
+    ASSERT_EQ(10'000u, lastCopied);
+
+    std::vector<float> copy(values.size());
+    ASSERT_TRUE(PrimitiveArray<float>::getRegionChunked(array, 0, std::span<float>(copy), {.chunkElements = 768, .threads = 3}));
+    ASSERT_EQ(values, copy);
+
+    // Cancelled after the first chunk, the rest are never copied
+    std::vector<float> partial(values.size(), -1.0f);
+    options.threads = 1;
+    options.progress = [](size_t, size_t) { return false; };
+    ASSERT_FALSE(PrimitiveArray<float>::getRegionChunked(array, 0, std::span<float>(partial), options));
+    ASSERT_EQ(999.0f, partial[999]);
+    ASSERT_EQ(-1.0f, partial[1000]);
+
+    ASSERT_THROW(PrimitiveArray<float>::getRegionChunked(array, 9'000, std::span<float>(copy)), std::runtime_error);
+
+    // An exception on a worker is rethrown on the calling thread
+    options.threads = 4;
+    options.progress = [](size_t copied, size_t) -> bool {
+        if (copied > 3000) {
+            throw std::logic_error("stop");
+        }
+        return true;
+    };
+    ASSERT_THROW(PrimitiveArray<float>::getRegionChunked(array, 0, std::span<float>(copy), options), std::logic_error);
+}
@@ -0,0 +1,89 @@
+//
+// BindingsTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "gtest/gtest.h"
+#include "JniPlusPlus.hpp"
+#include "JvmTestFixture.hpp"
+
+using namespace jni_pp;
+
+
+TEST_F(JvmTestFixture, WarmupTest)
+{
+    size_t initialCount = registeredBindingCount();
+    {
+        StaticMethod<int> jGetInt("dev.tmich.jnipp.test.TestStaticPrimitives", "getInt");
+        StaticField<int> jStaticInt("dev.tmich.jnipp.test.TestStaticPrimitives", "staticInt");
+        ASSERT_EQ(initialCount + 2, registeredBindingCount());
+
+        // Both (and anything else registered) resolve without being called
+        ASSERT_GE(warmup(), size_t(2));
+        ASSERT_EQ(7, jGetInt());
+    }
+    ASSERT_EQ(initialCount, registeredBindingCount());
+}
+
+TEST_F(JvmTestFixture, ResolveMembersTest)
+{
+    // Neither has a signature that resolves so both go through the single reflective lookup.  The last doesn't exist.
+    std::vector<MemberRequest> requests{
+        {"dev.tmich.jnipp.test.TestStaticPrimitives", "timesTwoInt", "", true, 1},
+        {"dev.tmich.jnipp.test.TestStaticPrimitives", "staticInt", "", true, -1},
+        {"dev.tmich.jnipp.test.TestStaticPrimitives", "noSuchMember", "", true, 0}
+    };
+    ASSERT_EQ(size_t(2), resolveMembers(requests));
+
+    // Already cached, so resolved again without going to Java
+    requests.pop_back();
+    ASSERT_EQ(size_t(2), resolveMembers(requests));
+
+    StaticField<int> jStaticInt("dev.tmich.jnipp.test.TestStaticPrimitives", "staticInt");
+    ASSERT_EQ(42, jStaticInt.get());
+}
+
+TEST_F(JvmTestFixture, WarmupUnresolvableTest)
+{
+    // Stale bindings: a missing class, a missing method, a missing field and a field with the wrong signature
+    StaticMethod<int> jNoClass("dev.tmich.jnipp.test.NoSuchClass", "getInt");
+    StaticMethod<int> jNoMethod("dev.tmich.jnipp.test.TestStaticPrimitives", "noSuchMethod");
+    StaticField<int> jNoField("dev.tmich.jnipp.test.TestStaticPrimitives", "noSuchField");
+    StaticField<int> jWrongSignature("dev.tmich.jnipp.test.TestStaticPrimitives", "staticInt", "Ljava/lang/String;");
+    StaticMethod<int> jGetInt("dev.tmich.jnipp.test.TestStaticPrimitives", "getInt");
+
+    // Warmup logs the failures and carries on with the rest
+    warmup();
+    ASSERT_FALSE(env()->ExceptionCheck());
+    ASSERT_EQ(7, jGetInt());
+
+    // Nothing was cached for them, each use looks them up again and throws
+    ASSERT_THROW(jNoClass(), resolution_error);
+    ASSERT_THROW(jNoClass(), resolution_error);
+    ASSERT_THROW(jNoMethod(), resolution_error);
+    ASSERT_THROW(jNoField.get(), resolution_error);
+    ASSERT_THROW(jWrongSignature.get(), resolution_error);
+    ASSERT_FALSE(env()->ExceptionCheck());
+}
+
+TEST_F(JvmTestFixture, ResolveMembersWithSignaturesTest)
+{
+    // Found with JNI from their signatures and checked for exportability in the same single call as the lookups by
+    // name.  The field with the wrong signature isn't looked up by name instead.
+    std::vector<MemberRequest> requests{
+        {"dev.tmich.jnipp.test.TestStaticPrimitives", "getInt", "()I", true, 0},
+        {"dev.tmich.jnipp.test.TestStaticPrimitives", "manifestInt", "I", true, -1},
+        {"dev.tmich.jnipp.test.TestStaticPrimitives", "timesTwoString", "", true, 1},
+        {"dev.tmich.jnipp.test.TestStaticPrimitives", "staticInt", "J", true, -1}
+    };
+    ASSERT_EQ(size_t(3), resolveMembers(requests));
+
+    StaticMethod<int> jGetInt("dev.tmich.jnipp.test.TestStaticPrimitives", "getInt", "()I");
+    ASSERT_EQ(7, jGetInt());
+}
@@ -0,0 +1,137 @@
+//
+// BuffersTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "JniPlusPlus.hpp"
+#include "jnipp/Buffers.hpp"
+#include "JvmTestFixture.hpp"
+
+using namespace jni_pp;
+
+TEST_F(JvmTestFixture, DirectBufferTest)
+{
+    StaticMethod<int, DirectBuffer> jSumBuffer("dev.tmich.jnipp.test.TestStaticPrimitives", "sumBuffer");
+    StaticMethod<DirectBuffer, int> jCountingBuffer("dev.tmich.jnipp.test.TestStaticPrimitives", "countingBuffer");
+
+    // Java reads the native memory directly
+    std::array<int8_t, 4> bytes{1, 2, 3, 4};
+    ASSERT_EQ(10, jSumBuffer(DirectBuffer(std::span<int8_t>(bytes))));
+    bytes[0] = 11;
+    ASSERT_EQ(20, jSumBuffer(DirectBuffer(std::span<int8_t>(bytes))));
+
+    // And native code the memory of a Java allocated buffer.  The field keeps it reachable.
+    StaticField<DirectBuffer> jStaticBuffer("dev.tmich.jnipp.test.TestStaticPrimitives", "staticBuffer");
+    jStaticBuffer.set(DirectBuffer(std::span<int8_t>(bytes)));
+    DirectBuffer fieldBuffer = jStaticBuffer.get();
+    ASSERT_EQ(static_cast<void *>(bytes.data()), static_cast<void *>(fieldBuffer.data()));
+    ASSERT_EQ(4u, fieldBuffer.size());
+
+    DirectBuffer counting = jCountingBuffer(16);
+    ASSERT_EQ(16u, counting.size());
+    ASSERT_EQ(std::byte(15), counting.bytes()[15]);
+    ASSERT_EQ(4u, counting.as<int32_t>().size());
+
+    jStaticBuffer.set(DirectBuffer());
+    ASSERT_TRUE(jStaticBuffer.get().empty());
+}
+
+TEST_F(JvmTestFixture, DirectBufferPoolTest)
+{
+    DirectBufferPool pool(100, 4, 2);
+    DirectBuffer block = pool.acquire();
+    ASSERT_EQ(100u, block.size());
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(block.data()) % 64);
+    pool.release(block);
+
+    // Java returns each buffer, so the same block and ByteBuffer are lent every time
+    StaticMethod<int, jobject> jSumAndRelease("dev.tmich.jnipp.test.TestStaticPrimitives", "sumAndReleaseBuffer", "(Ljava/nio/ByteBuffer;)I");
+    for (int i = 0; i < 20; ++i) {
+        jobject byteBuffer = pool.lend();
+        DirectBuffer lent = fromJavaByteBuffer(byteBuffer);
+        std::fill(lent.bytes().begin(), lent.bytes().end(), std::byte(1));
+        ASSERT_EQ(100, jSumAndRelease(byteBuffer));
+        env()->DeleteLocalRef(byteBuffer);
+    }
+    BufferPoolStats stats = pool.stats();
+    ASSERT_EQ(4u, stats.capacity);
+    ASSERT_EQ(1u, stats.slabs);
+    ASSERT_EQ(0u, stats.inUse);
+    ASSERT_EQ(1u, stats.peakInUse);
+
+    // Grows to maxSlabs then throws
+    std::vector<DirectBuffer> blocks;
+    for (int i = 0; i < 8; ++i) {
+        blocks.push_back(pool.acquire());
+    }
+    ASSERT_THROW(pool.acquire(), std::runtime_error);
+    ASSERT_EQ(8u, pool.stats().peakInUse);
+
+    // Only the start of a block releases it
+    ASSERT_FALSE(releasePooledBlock(blocks[0].data() + 1));
+    ASSERT_FALSE(releasePooledBlock(blocks[0].data() + blocks[0].size()));
+    ASSERT_EQ(8u, pool.stats().inUse);
+    StaticMethod<void, jobject> jReleaseSlice("dev.tmich.jnipp.test.TestStaticPrimitives", "releaseSlice", "(Ljava/nio/ByteBuffer;)V");
+    pool.release(blocks.back());
+    blocks.pop_back();
+    jobject sliced = pool.lend();
+    jReleaseSlice(sliced);
+    ASSERT_EQ(8u, pool.stats().inUse);
+    pool.release(sliced);
+    env()->DeleteLocalRef(sliced);
+    for (auto& acquired : blocks) {
+        pool.release(acquired);
+    }
+    ASSERT_EQ(0u, pool.stats().inUse);
+}
+
+TEST_F(JvmTestFixture, DirectBufferPoolTrackedTest)
+{
+    StaticMethod<void> jGc("java.lang.System", "gc");
+    DirectBufferPool pool(64, 4);
+
+    // Collect garbage until the releaser thread has brought the pool down to inUse blocks, or rounds run out
+    auto collectUntil = [&](size_t inUse, int rounds) {
+        for (int i = 0; i < rounds && pool.stats().inUse > inUse; ++i) {
+            jGc();
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return pool.stats().inUse;
+    };
+
+    // Returned when Java collects it, without any explicit release
+    jobject collected = pool.lendTracked();
+    env()->DeleteLocalRef(collected);
+    ASSERT_EQ(1u, pool.stats().inUse);
+    ASSERT_EQ(0u, collectUntil(0, 100));
+
+    // Released explicitly, so its block is lent again, and collected later.  That release must not free the block's
+    // new lend.  The sentinel, collected in the same rounds, shows the collections have happened.
+    jobject released = pool.lendTracked();
+    void *address = fromJavaByteBuffer(released).data();
+    pool.release(released);
+    env()->DeleteLocalRef(released);
+    DirectBuffer again = pool.acquire();
+    ASSERT_EQ(address, static_cast<void *>(again.data()));
+    jobject sentinel = pool.lendTracked();
+    env()->DeleteLocalRef(sentinel);
+    ASSERT_EQ(1u, collectUntil(1, 100));
+    ASSERT_EQ(1u, collectUntil(0, 10));
+    pool.release(again);
+    ASSERT_EQ(0u, pool.stats().inUse);
+}
@@ -0,0 +1,90 @@
+//
+// ConcurrentCacheTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "jnipp/ConcurrentCache.hpp"
+
+using namespace jni_pp;
+
+template <typename StringType>
+struct TestKey {
+    explicit TestKey(StringType name) : name(name), precomputedHash(KeyHasher().add(name).value()) {}
+    template <typename Other>
+    explicit TestKey(const TestKey<Other>& other) : name(other.name), precomputedHash(other.hash()) {}
+
+    size_t hash() const { return precomputedHash; }
+    template <typename Other>
+    bool operator==(const TestKey<Other>& other) const { return name == other.name; }
+
+    StringType name;
+    size_t precomputedHash;
+};
+
+TEST(ConcurrentCacheTests, FindAndInsertTest)
+{
+    ConcurrentCache<TestKey<std::string>, int> cache;
+
+    ASSERT_FALSE(cache.find(TestKey<std::string_view>("missing")).has_value());
+
+    ASSERT_EQ(1, cache.findOrInsert(TestKey<std::string_view>("one"), [] { return 1; }));
+    // Already present, factory must not be used
+    ASSERT_EQ(1, cache.findOrInsert(TestKey<std::string_view>("one"), [] { return 2; }));
+    ASSERT_EQ(1, cache.find(TestKey<std::string_view>("one")).value());
+
+    ASSERT_NE(KeyHasher().add("ab").add("c").value(), KeyHasher().add("a").add("bc").value());
+}
+
+TEST(ConcurrentCacheTests, BoundedInsertTest)
+{
+    ConcurrentCache<TestKey<std::string>, int, 1> cache;
+
+    for (int i = 0; i < 10; ++i) {
+        auto name = std::to_string(i);
+        ASSERT_EQ(i, cache.findOrInsertBounded(TestKey<std::string_view>(name), [i] { return i; }, 4));
+        ASSERT_LE(cache.size(), 4u);
+    }
+    // Still there, not replaced
+    ASSERT_EQ(9, cache.findOrInsertBounded(TestKey<std::string_view>("9"), [] { return -1; }, 4));
+
+    cache.clear();
+    ASSERT_EQ(0u, cache.size());
+}
+
+TEST(ConcurrentCacheTests, ConcurrentInsertTest)
+{
+    ConcurrentCache<TestKey<std::string>, int> cache;
+    std::atomic<int> factoryCalls(0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 1000; ++i) {
+                std::string name = "key" + std::to_string(i);
+                int value = cache.findOrInsert(TestKey<std::string_view>(name), [&] {
+                    ++factoryCalls;
+                    return i;
+                });
+                ASSERT_EQ(i, value);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every key was created exactly once no matter how many threads raced for it
+    ASSERT_EQ(1000, factoryCalls.load());
+}
@@ -54,3 +54,13 @@ TEST_F(JvmTestFixture, ConvertCppToJavaTest)
     ASSERT_DOUBLE_EQ(kTestDouble, cdouble) << "Test double " << kTestDouble << " should be equal to converted double " << cdouble;
 }
 
+TEST(JniSignatureTests, CompileTimeSignatureTest)
+{
+    static_assert(JniMethodSignature<void>::value.view() == "()V");
+    static_assert(JniMethodSignature<int, int, std::string, bool>::value.view() == "(ILjava/lang/String;Z)I");
+    static_assert(JniMethodSignature<JvmObject<"java.lang.reflect.Field">, const std::string&, jboxedint>::value.view() ==
+                  "(Ljava/lang/String;Ljava/lang/Integer;)Ljava/lang/reflect/Field;");
+
+    ASSERT_EQ(std::string("Ljava/util/regex/Pattern;"), JniSignature<JvmObject<"java.util.regex.Pattern">>::signature().view());
+    ASSERT_EQ(std::string("java.util.regex.Pattern"), JniSignature<JvmObject<"java.util.regex.Pattern">>::typeName().view());
+}
@@ -0,0 +1,40 @@
+//
+// ExportRulesTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include "gtest/gtest.h"
+#include "JniPlusPlus.hpp"
+#include "JvmTestFixture.hpp"
+
+using namespace jni_pp;
+
+
+TEST_F(JvmTestFixture, PackageRulesTest)
+{
+    StaticMethod<void, std::string, bool> jSetRequiresExport("dev.tmich.jnipp.JavaToNativeExporter", "setRequiresExport");
+    StaticMethod<bool, std::string> jDoesPackageRequireExport("dev.tmich.jnipp.JavaToNativeExporter", "doesPackageRequireExport");
+
+    // Nothing configured
+    ASSERT_FALSE(jDoesPackageRequireExport("com.example.rules"));
+
+    jSetRequiresExport("com.example.rules", true);
+    jSetRequiresExport("com.example.rules.generated", false);
+
+    // Longest configured package wins and applies to subpackages, but not to packages that only share a prefix
+    ASSERT_TRUE(jDoesPackageRequireExport("com.example.rules"));
+    ASSERT_TRUE(jDoesPackageRequireExport("com.example.rules.backend.parsers"));
+    ASSERT_FALSE(jDoesPackageRequireExport("com.example.rules.generated.swig"));
+    ASSERT_FALSE(jDoesPackageRequireExport("com.example.rulesets"));
+    ASSERT_FALSE(jDoesPackageRequireExport("com.example"));
+
+    // Changing a rule replaces it
+    jSetRequiresExport("com.example.rules", false);
+    ASSERT_FALSE(jDoesPackageRequireExport("com.example.rules.backend"));
+}
@@ -0,0 +1,52 @@
+//
+// ResolutionManifestTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+#include "JniPlusPlus.hpp"
+#include "jnipp/ResolutionManifest.hpp"
+#include "JvmTestFixture.hpp"
+
+using namespace jni_pp;
+
+
+TEST_F(JvmTestFixture, ResolutionManifestTest)
+{
+    const std::string path = "jnipp_resolution_manifest_test.txt";
+    std::remove(path.c_str());
+
+    setResolutionManifest(path);
+    ASSERT_TRUE(isResolutionManifestEnabled());
+    auto before = getResolutionManifestStats();
+
+    // No signature so this goes through the reflective lookup and is recorded
+    StaticField<int> jManifestInt("dev.tmich.jnipp.test.TestStaticPrimitives", "manifestInt");
+    ASSERT_EQ(11, jManifestInt.get());
+
+    auto after = getResolutionManifestStats();
+    ASSERT_EQ(before.recorded + 1, after.recorded);
+    ASSERT_TRUE(saveResolutionManifest());
+
+    std::ifstream in(path);
+    std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ASSERT_NE(std::string::npos, contents.find("dev.tmich.jnipp.test.TestStaticPrimitives\tmanifestInt\t-1\t\t"));
+    ASSERT_NE(std::string::npos, contents.find("\tI\n"));
+
+    // Reloading picks up what was saved
+    setResolutionManifest(path);
+    ASSERT_EQ(after.entries, getResolutionManifestStats().entries);
+
+    setResolutionManifest("");
+    ASSERT_FALSE(isResolutionManifestEnabled());
+    std::remove(path.c_str());
+}
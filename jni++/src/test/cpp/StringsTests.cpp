@@ -0,0 +1,187 @@
+//
+// StringsTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <memory_resource>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "JniPlusPlus.hpp"
+#include "jnipp/Strings.hpp"
+#include "JvmTestFixture.hpp"
+
+using namespace jni_pp;
+
+
+TEST_F(JvmTestFixture, InternedStringTest)
+{
+    InternedJString number("1234");
+    StaticMethod<int, InternedJString> jParseInt("java.lang.Integer", "parseInt");
+    ASSERT_EQ(1234, jParseInt(number));
+
+    // Created once, the same global reference is passed every time
+    jstring first = number.get();
+    ASSERT_EQ(1234, jParseInt(number));
+    ASSERT_EQ(first, number.get());
+    ASSERT_EQ(JNIGlobalRefType, env()->GetObjectRefType(first));
+
+    StaticMethod<int, JavaStringConst<"5678">> jParseConst("java.lang.Integer", "parseInt");
+    ASSERT_EQ(5678, jParseConst({}));
+    ASSERT_EQ(5678, jParseInt(JavaStringConst<"5678">()));
+    ASSERT_EQ(JavaStringConst<"5678">::interned().get(), JavaStringConst<"5678">::interned().get());
+}
+
+TEST_F(JvmTestFixture, StringConversionTest)
+{
+    StaticMethod<std::string, std::string> jValueOf("java.lang.String", "valueOf", "(Ljava/lang/Object;)Ljava/lang/String;");
+    StaticMethod<int, std::string> jCodePoints("dev.tmich.jnipp.test.TestStaticPrimitives", "codePointCount");
+
+    // Supplementary characters are a single code point in Java and four bytes of standard UTF-8 back in C++
+    std::string emoji("smile \xF0\x9F\x98\x80");
+    ASSERT_EQ(7, jCodePoints(emoji));
+    ASSERT_EQ(emoji, jValueOf(emoji));
+
+    // Long enough to use the critical path
+    std::string longString(1000, 'y');
+    longString += "\xC3\xA9";
+    ASSERT_EQ(1001, jCodePoints(longString));
+    ASSERT_EQ(longString, jValueOf(longString));
+}
+
+TEST_F(JvmTestFixture, StringViewArgumentTest)
+{
+    StaticMethod<std::string, std::string_view> jTimesTwo("dev.tmich.jnipp.test.TestStaticPrimitives", "timesTwoString");
+    StaticMethod<int, std::u16string_view> jCodePoints("dev.tmich.jnipp.test.TestStaticPrimitives", "codePointCount");
+
+    // A slice of a larger buffer, not NUL terminated
+    std::string buffer("xxhello\xC3\xA9xx");
+    std::string_view slice(buffer.data() + 2, buffer.size() - 4);
+    ASSERT_EQ("hello\xC3\xA9hello\xC3\xA9", jTimesTwo(slice));
+
+    ASSERT_EQ(7, jCodePoints(std::u16string_view(u"smile \U0001F600")));
+}
+
+TEST_F(JvmTestFixture, JavaStringTest)
+{
+    StaticMethod<JavaString, std::string> jTimesTwo("dev.tmich.jnipp.test.TestStaticPrimitives", "timesTwoString");
+
+    JavaString result = jTimesTwo("h\xC3\xA9");
+    ASSERT_TRUE(result);
+    ASSERT_EQ(4u, result.length());
+    ASSERT_TRUE(result.equals("h\xC3\xA9h\xC3\xA9"));
+    ASSERT_FALSE(result.equals("h\xC3\xA9h\xC3\xA8"));
+    ASSERT_FALSE(result.equals("h\xC3\xA9"));
+    {
+        auto view = result.utf16_view();
+        ASSERT_EQ(std::u16string_view(u"héhé"), view.view());
+    }
+    ASSERT_EQ("h\xC3\xA9h\xC3\xA9", result.utf8());
+
+    // Passed straight back to Java without converting
+    StaticMethod<int, JavaString> jCodePoints("dev.tmich.jnipp.test.TestStaticPrimitives", "codePointCount");
+    JavaString kept = result.global();
+    ASSERT_EQ(4, jCodePoints(kept));
+}
+
+TEST_F(JvmTestFixture, CallIntoTest)
+{
+    StaticMethod<std::string, std::string> jTimesTwo("dev.tmich.jnipp.test.TestStaticPrimitives", "timesTwoString");
+
+    std::string out;
+    out.reserve(64);
+    auto *storage = out.data();
+    jTimesTwo.call_into(out, "abc");
+    ASSERT_EQ("abcabc", out);
+    jTimesTwo.call_into(out, "h\xC3\xA9");
+    ASSERT_EQ("h\xC3\xA9h\xC3\xA9", out);
+    ASSERT_EQ(storage, out.data());
+
+    char arena[256];
+    std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena));
+    std::pmr::string pmrOut(&resource);
+    jTimesTwo.call_into(pmrOut, "xyz");
+    ASSERT_EQ("xyzxyz", pmrOut);
+
+    char buffer[8];
+    ASSERT_EQ(6u, jTimesTwo.call_into(buffer, sizeof(buffer), "abc"));
+    ASSERT_STREQ("abcabc", buffer);
+    ASSERT_EQ(12u, jTimesTwo.call_into(buffer, sizeof(buffer), "abcdef"));
+    ASSERT_STREQ("", buffer);
+}
+
+TEST_F(JvmTestFixture, StreamStringTest)
+{
+    StaticMethod<JavaString, std::string> jTimesTwo("dev.tmich.jnipp.test.TestStaticPrimitives", "timesTwoString");
+
+    std::string half;
+    for (int i = 0; i < 500; ++i) {
+        half += "ab\xF0\x9F\x98\x80";   // Surrogate pairs land on every chunk boundary
+    }
+    JavaString result = jTimesTwo(half);
+
+    std::string streamed;
+    size_t chunks = 0;
+    ASSERT_EQ(half.size() * 2, result.stream([&](std::string_view chunk) {
+        streamed.append(chunk);
+        ++chunks;
+        return true;
+    }, 5));
+    ASSERT_EQ(half + half, streamed);
+    ASSERT_GT(chunks, 1u);
+
+    std::ostringstream out;
+    result.stream(out);
+    ASSERT_EQ(half + half, out.str());
+
+    // Stopping after the first chunk
+    size_t bytes = result.stream([](std::string_view) { return false; }, 16);
+    ASSERT_LT(bytes, half.size());
+}
+
+TEST_F(JvmTestFixture, DedupStringTest)
+{
+    StaticMethod<DedupString, std::string> jTimesTwo("dev.tmich.jnipp.test.TestStaticPrimitives", "timesTwoString");
+
+    clearStringCache();
+    auto before = getStringCacheStats();
+    SharedString first = jTimesTwo("ok");
+    SharedString second = jTimesTwo("ok");
+    ASSERT_EQ("okok", *first);
+    ASSERT_EQ(first.get(), second.get());
+
+    auto after = getStringCacheStats();
+    ASSERT_EQ(before.misses + 1, after.misses);
+    ASSERT_EQ(before.hits + 1, after.hits);
+
+    // Too long to cache, still converted
+    std::string longString(kMaxDedupUnits, 'z');
+    ASSERT_EQ(longString + longString, *jTimesTwo(longString));
+    ASSERT_EQ(after.uncached + 1, getStringCacheStats().uncached);
+}
+
+TEST_F(JvmTestFixture, StringArrayTest)
+{
+    StaticMethod<std::vector<std::string>, std::vector<std::string>> jReverse("dev.tmich.jnipp.test.TestStaticPrimitives", "reverseStrings");
+
+    std::vector<std::string> values{"one", "", "smile \xF0\x9F\x98\x80"};
+    ASSERT_EQ((std::vector<std::string>{"smile \xF0\x9F\x98\x80", "", "one"}), jReverse(values));
+    ASSERT_TRUE(jReverse({}).empty());
+
+    // Enough to be unpacked on several threads
+    std::vector<std::string> many;
+    for (int i = 0; i < 20000; ++i) {
+        many.push_back(std::to_string(i) + std::string(100, 'x'));
+    }
+    auto reversed = jReverse(many);
+    ASSERT_EQ(many.size(), reversed.size());
+    for (size_t i = 0; i < many.size(); ++i) {
+        ASSERT_EQ(many[i], reversed[many.size() - 1 - i]);
+    }
+}
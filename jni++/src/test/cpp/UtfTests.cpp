@@ -0,0 +1,95 @@
+//
+// UtfTests.cpp
+// jni++
+//
+// Created by agent Oct 17, 2026.
+//
+// Copyright © 2026 agent All rights reserved.
+//
+// This code is licensed under the 2-clause BSD license (see LICENSE.md for details)
+//
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "jnipp/Utf.hpp"
+
+using namespace jni_pp;
+
+static std::string toUtf8(const std::u16string& utf16) {
+    std::string utf8;
+    utf16ToUtf8(utf16.data(), utf16.size(), utf8);
+    return utf8;
+}
+
+static std::u16string toUtf16(const std::string& utf8) {
+    std::u16string utf16(maxUtf16Length(utf8.size()), u'\0');
+    utf16.resize(utf8ToUtf16(utf8.data(), utf8.size(), utf16.data()));
+    return utf16;
+}
+
+TEST(UtfTests, RoundTripTest)
+{
+    // Long enough to go through the block paths, with each encoded length and a supplementary character
+    std::string utf8 = "ASCII only, more than sixteen characters. \xC3\xA9t\xC3\xA9 \xE2\x82\xAC 100 \xF0\x9F\x98\x80 end";
+    std::u16string utf16 = u"ASCII only, more than sixteen characters. été € 100 \U0001F600 end";
+
+    ASSERT_EQ(utf16, toUtf16(utf8));
+    ASSERT_EQ(utf8, toUtf8(utf16));
+    ASSERT_EQ(utf8.size(), utf8Length(utf16.data(), utf16.size()));
+
+    // Embedded NUL is one byte, not the two byte modified UTF-8 form
+    ASSERT_EQ(std::string("a\0b", 3), toUtf8(std::u16string(u"a\0b", 3)));
+}
+
+TEST(UtfTests, InvalidInputTest)
+{
+    // Unpaired surrogates
+    ASSERT_EQ("\xEF\xBF\xBD" "a", toUtf8(std::u16string{char16_t(0xD800), u'a'}));
+    ASSERT_EQ("a\xEF\xBF\xBD", toUtf8(std::u16string{u'a', char16_t(0xDC00)}));
+
+    // Overlong NUL, CESU surrogate, above U+10FFFF and truncated sequences
+    ASSERT_EQ(u"\uFFFD\uFFFD", toUtf16("\xC0\x80"));
+    ASSERT_EQ(u"\uFFFD\uFFFD\uFFFD", toUtf16("\xED\xA0\x80"));
+    ASSERT_EQ(u"\uFFFD\uFFFD\uFFFD\uFFFD", toUtf16("\xF4\x90\x80\x80"));
+    ASSERT_EQ(u"a\uFFFD", toUtf16("a\xE2\x82"));
+}
+
+TEST(UtfTests, AsciiTest)
+{
+    ASSERT_TRUE(isAscii("", 0));
+    std::string ascii(100, 'x');
+    ASSERT_TRUE(isAscii(ascii.data(), ascii.size()));
+    ascii[73] = char(0xC3);
+    ASSERT_FALSE(isAscii(ascii.data(), ascii.size()));
+}
+
+TEST(UtfTests, AsciiToUtf16Test)
+{
+    std::string ascii;
+    for (int i = 0; i < 100; ++i) {
+        ascii.push_back(char(i));
+    }
+    std::u16string utf16(ascii.size(), u'\0');
+    asciiToUtf16(ascii.data(), ascii.size(), utf16.data());
+    ASSERT_EQ(toUtf16(ascii), utf16);
+}
+
+TEST(UtfTests, EqualsTest)
+{
+    auto equals = [](const std::u16string& utf16, const std::string& utf8) {
+        return utf16EqualsUtf8(utf16.data(), utf16.size(), utf8.data(), utf8.size());
+    };
+    ASSERT_TRUE(equals(u"", ""));
+    ASSERT_TRUE(equals(u"smile \U0001F600", "smile \xF0\x9F\x98\x80"));
+    ASSERT_FALSE(equals(u"smile", "smile!"));
+    ASSERT_FALSE(equals(u"smile!", "smile"));
+
+    // Surrogate pairs straddling the internal block boundary
+    std::u16string longUtf16 = std::u16string(63, u'a') + u"\U0001F600" + std::u16string(100, u'é');
+    std::string longUtf8 = toUtf8(longUtf16);
+    ASSERT_TRUE(equals(longUtf16, longUtf8));
+    longUtf8.back() = 'x';
+    ASSERT_FALSE(equals(longUtf16, longUtf8));
+    ASSERT_TRUE(equals(u"a\xD800", "a\xEF\xBF\xBD"));
+}
@@ -11,9 +11,19 @@
 
 package dev.tmich.jnipp.test;
 
+import dev.tmich.jnipp.JavaToNativeExporter;
+
+import java.nio.ByteBuffer;
+
 public class TestStaticPrimitives {
+    public static int staticInt = 42;
+    public static int manifestInt = 11;
+    public static ByteBuffer staticBuffer;
+    public static double[] staticDoubles = {1.5, 2.5, 3.5};
+
     public static int getInt() { return 7; }
     public static int timesTwoInt(int inval) { return 2 * inval; }
+    public static int codePointCount(String value) { return value.codePointCount(0, value.length()); }
 
     public static short getShort() { return 7; }
     public static short timesTwoShort(short inval) { return (short) (2 * inval); }
@@ -38,4 +48,49 @@ public class TestStaticPrimitives {
 
     public static String getString() { return "Welcome to the JVM"; }
     public static String timesTwoString(String inval) { return inval + inval; }
+    public static int sumBuffer(ByteBuffer buffer) {
+        int sum = 0;
+        for (int i = 0; i < buffer.capacity(); i++) {
+            sum += buffer.get(i);
+        }
+        return sum;
+    }
+    public static ByteBuffer countingBuffer(int size) {
+        ByteBuffer buffer = ByteBuffer.allocateDirect(size);
+        for (int i = 0; i < size; i++) {
+            buffer.put(i, (byte) i);
+        }
+        return buffer;
+    }
+    public static int sumAndReleaseBuffer(ByteBuffer buffer) {
+        int sum = sumBuffer(buffer);
+        buffer.position(1);
+        JavaToNativeExporter.releasePooledBuffer(buffer);
+        return sum;
+    }
+    public static void releaseSlice(ByteBuffer buffer) {
+        buffer.position(1);
+        JavaToNativeExporter.releasePooledBuffer(buffer.slice());
+    }
+    public static int[] roundFloats(float[] values) {
+        int[] rounded = new int[values.length];
+        for (int i = 0; i < values.length; i++) {
+            rounded[i] = Math.round(values[i]);
+        }
+        return rounded;
+    }
+    public static boolean[] invertBooleans(boolean[] values) {
+        boolean[] inverted = new boolean[values.length];
+        for (int i = 0; i < values.length; i++) {
+            inverted[i] = !values[i];
+        }
+        return inverted;
+    }
+    public static String[] reverseStrings(String[] values) {
+        String[] reversed = new String[values.length];
+        for (int i = 0; i < values.length; i++) {
+            reversed[values.length - 1 - i] = values[i];
+        }
+        return reversed;
+    }
 }